@@ -0,0 +1,102 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <utility>
+#include <vector>
+
+// A minimal timing harness for the microbenchmarks, they are compiled with
+// the rest of the project but never run by ctest
+// Every case reports the best time per iteration out of a few rounds, which
+// is the least disturbed by the other processes of the machine
+namespace bench
+{
+using suite_fn = void (*)();
+
+inline std::vector<std::pair<const char*, suite_fn>>& suites()
+{
+    static std::vector<std::pair<const char*, suite_fn>> registered;
+    return registered;
+}
+
+// registers a suite from a static object, so every source file adds its
+// own suites without a list in main
+struct registrar
+{
+    registrar(const char* name, suite_fn fn)
+    {
+        suites().emplace_back(name, fn);
+    }
+};
+
+// keeps the optimizer from dropping a result that is never used
+template <typename T>
+inline void do_not_optimize(const T& value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r"(&value) : "memory");
+#else
+    static const void* volatile sink;
+    sink = &value;
+#endif
+}
+
+constexpr size_t default_rounds = 5;
+
+// the best time of a call of body in nanoseconds, body runs iterations
+// times per round
+template <typename Fn>
+double best_ns(size_t iterations, Fn&& body, size_t rounds = default_rounds)
+{
+    double best = 0;
+    for (size_t round = 0; round < rounds; ++round)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < iterations; ++i)
+        {
+            body();
+        }
+        const auto end = std::chrono::steady_clock::now();
+        const double ns =
+            std::chrono::duration<double, std::nano>(end - start).count() /
+            double(iterations);
+        best = round == 0 ? ns : std::min(best, ns);
+    }
+    return best;
+}
+
+inline void report(const char* name, double ns)
+{
+    if (ns >= 1'000'000)
+    {
+        std::printf("  %-52s %10.2f ms\n", name, ns / 1'000'000);
+    }
+    else if (ns >= 1'000)
+    {
+        std::printf("  %-52s %10.2f us\n", name, ns / 1'000);
+    }
+    else
+    {
+        std::printf("  %-52s %10.2f ns\n", name, ns);
+    }
+}
+
+template <typename Fn>
+void measure(const char* name, size_t iterations, Fn&& body)
+{
+    report(name, best_ns(iterations, std::forward<Fn>(body)));
+}
+}  // namespace bench
+
+#define BENCH_CONCAT_IMPL(a, b) a##b
+#define BENCH_CONCAT(a, b) BENCH_CONCAT_IMPL(a, b)
+
+// BENCH_SUITE("name") { ... } defines and registers a suite
+#define BENCH_SUITE(name)                                               \
+    static void BENCH_CONCAT(bench_suite_, __LINE__)();                 \
+    static const bench::registrar BENCH_CONCAT(bench_registrar_,        \
+                                               __LINE__)(               \
+        name, &BENCH_CONCAT(bench_suite_, __LINE__));                   \
+    static void BENCH_CONCAT(bench_suite_, __LINE__)()
@@ -0,0 +1,154 @@
+#include "bench.hpp"
+
+#include "big_int.hpp"
+#include "big_int_batch_multiply.hpp"
+#include "big_int_util.hpp"
+
+#include <vector>
+
+template <size_t size>
+static big_int<size> random_number(u32 seed, size_t length = size)
+{
+    big_int<size> res;
+    u32 state = seed;
+    for (size_t i = 0; i < length; ++i)
+    {
+        state = state * 1'103'515'245U + 12'345U;
+        res.raw[i] = u8(state >> 16);
+    }
+    return res;
+}
+
+// the byte by byte loop operator+= takes below lookahead_threshold, as the
+// baseline of the carry-lookahead addition
+template <size_t size>
+static void ripple_add(big_int<size>& dest, const big_int<size>& other)
+{
+    bool carry = false;
+    for (size_t i = 0; i < size; ++i)
+    {
+        const u8 old = dest.raw[i];
+        dest.raw[i] = u8(dest.raw[i] + other.raw[i]);
+        const bool overflowed_on_sum = dest.raw[i] < old;
+
+        const u8 summed = dest.raw[i];
+        dest.raw[i] = u8(dest.raw[i] + carry);
+
+        const bool overflowed_on_carry = dest.raw[i] < summed;
+        carry = overflowed_on_carry || overflowed_on_sum;
+    }
+}
+
+template <size_t size>
+static void addition_case(const char* lookahead_name, const char* ripple_name)
+{
+    big_int<size> sum = random_number<size>(3);
+    const big_int<size> addend = random_number<size>(5);
+
+    bench::measure(lookahead_name, 10'000,
+                   [&]
+                   {
+                       sum += addend;
+                       bench::do_not_optimize(sum);
+                   });
+    bench::measure(ripple_name, 10'000,
+                   [&]
+                   {
+                       ripple_add(sum, addend);
+                       bench::do_not_optimize(sum);
+                   });
+}
+
+BENCH_SUITE("carry-lookahead addition")
+{
+    addition_case<32>("32 bytes, operator+=", "32 bytes, byte ripple");
+    addition_case<512>("512 bytes, operator+=", "512 bytes, byte ripple");
+    addition_case<4096>("4096 bytes, operator+=", "4096 bytes, byte ripple");
+}
+
+#ifdef ENABLE_BIG_INT_UTIL
+
+// the bisection the tests check the roots against, as the baseline
+template <size_t size>
+static big_int<size> bisection_root(const big_int<size>& number, size_t k)
+{
+    using wide_t = big_int<size * 2>;
+    const wide_t wide_number = wide_t(number);
+
+    wide_t low = 0;
+    wide_t high = 0;
+    high.set_bit(number.bit_width() / k + 1);
+    while (wide_t(1) < high - low)
+    {
+        const wide_t mid = low + (high - low) / wide_t(2);
+        wide_t power = 1;
+        for (size_t i = 0; i < k; ++i)
+        {
+            power *= mid;
+        }
+        (wide_number < power ? high : low) = mid;
+    }
+    return big_int<size>(low);
+}
+
+BENCH_SUITE("isqrt and iroot")
+{
+    // below the sign bit, so the numbers stay positive
+    const big_int<32> number = random_number<32>(7, 31);
+
+    bench::measure("isqrt, Newton, 31 bytes", 200,
+                   [&] { bench::do_not_optimize(isqrt(number)); });
+    bench::measure("isqrt, bisection, 31 bytes", 200,
+                   [&] { bench::do_not_optimize(bisection_root(number, 2)); });
+    bench::measure("iroot 5, Newton, 31 bytes", 200,
+                   [&] { bench::do_not_optimize(iroot(number, 5)); });
+    bench::measure("iroot 5, bisection, 31 bytes", 200,
+                   [&] { bench::do_not_optimize(bisection_root(number, 5)); });
+}
+
+#endif  // ENABLE_BIG_INT_UTIL
+
+#ifdef ENABLE_BIG_INT_BATCH
+
+template <size_t size>
+static void multiply_many_case(const char* batched_name,
+                               const char* loop_name)
+{
+    constexpr size_t count = 1'024;
+    std::vector<big_int<size>> a(count);
+    std::vector<big_int<size>> b(count);
+    std::vector<big_int<size>> out(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        a[i] = random_number<size>(u32(i + 1));
+        b[i] = random_number<size>(u32(i + count));
+    }
+
+    bench::measure(batched_name, 100,
+                   [&]
+                   {
+                       multiply_many(a.data(), b.data(), out.data(), count);
+                       bench::do_not_optimize(out);
+                   });
+    bench::measure(loop_name, 100,
+                   [&]
+                   {
+                       for (size_t i = 0; i < count; ++i)
+                       {
+                           out[i] = a[i] * b[i];
+                       }
+                       bench::do_not_optimize(out);
+                   });
+}
+
+BENCH_SUITE("multiply_many")
+{
+    multiply_many_case<16>("1024 x 16 bytes, multiply_many",
+                           "1024 x 16 bytes, operator*");
+    multiply_many_case<32>("1024 x 32 bytes, multiply_many",
+                           "1024 x 32 bytes, operator*");
+    multiply_many_case<64>("1024 x 64 bytes, multiply_many",
+                           "1024 x 64 bytes, operator*");
+}
+
+#endif  // ENABLE_BIG_INT_BATCH
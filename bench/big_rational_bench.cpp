@@ -0,0 +1,47 @@
+#include "bench.hpp"
+
+#include "big_int.hpp"
+#include "big_rational.hpp"
+
+#ifdef ENABLE_BIG_INT_UTIL
+
+// the gcd reduction is deferred until the fraction runs out of headroom,
+// the eager variant reduces after every operation
+BENCH_SUITE("big_rational")
+{
+    const big_rational<32> first_factor(big_int<32>(3), big_int<32>(7));
+    const big_rational<32> second_factor(big_int<32>(14), big_int<32>(9));
+
+    // a round comes back to the same value, so the fraction only grows
+    // until it is reduced
+    big_rational<32> lazy(big_int<32>(5), big_int<32>(11));
+    bench::measure("round of 3/7 and 14/9, lazy reduction", 20'000,
+                   [&]
+                   {
+                       lazy *= first_factor;
+                       lazy *= second_factor;
+                       lazy /= first_factor;
+                       lazy /= second_factor;
+                       bench::do_not_optimize(lazy);
+                   });
+
+    big_rational<32> eager(big_int<32>(5), big_int<32>(11));
+    bench::measure("round of 3/7 and 14/9, reduced every time", 20'000,
+                   [&]
+                   {
+                       eager *= first_factor;
+                       eager.normalize();
+                       eager *= second_factor;
+                       eager.normalize();
+                       eager /= first_factor;
+                       eager.normalize();
+                       eager /= second_factor;
+                       eager.normalize();
+                       bench::do_not_optimize(eager);
+                   });
+
+    // both still hold 5/11
+    bench::do_not_optimize(lazy == eager);
+}
+
+#endif  // ENABLE_BIG_INT_UTIL
@@ -0,0 +1,99 @@
+// Compile time of a chain of products of dimensioned quantities, nothing
+// here runs, the targets are only compiled
+// BENCH_CHAIN_LENGTH is the number of products, 20, 40 or 80, and
+// BENCH_HAND_SPECIALIZED replaces the dimensions by a units_multiplied
+// specialization for every pair, the way units were defined before
+// bench/CMakeLists.txt builds every combination, time one of them with
+//     cmake --build . --target dimension_chain_80_hand --verbose
+// and -ftime-report in CMAKE_CXX_FLAGS, or with the wall clock
+#include "big_int.hpp"
+#include "strong_decorators.hpp"
+#include "strong_dimensions.hpp"
+#include "strong_type.hpp"
+
+#include <cstddef>
+#include <utility>
+
+#ifndef BENCH_CHAIN_LENGTH
+#define BENCH_CHAIN_LENGTH 20
+#endif
+
+static_assert(BENCH_CHAIN_LENGTH == 20 || BENCH_CHAIN_LENGTH == 40 ||
+                  BENCH_CHAIN_LENGTH == 80,
+              "the chain has 20, 40 or 80 products");
+
+// every product has a new type on the left, so each one instantiates
+// units_multiplied, the decorators and the strong type once more
+template <typename start_t, typename factor_t, size_t... step>
+static auto product_chain(const start_t& start,
+                          const factor_t& factor,
+                          std::index_sequence<step...>)
+{
+    return (start * ... * ((void)step, factor));
+}
+
+#ifdef BENCH_HAND_SPECIALIZED
+
+template <int step>
+struct chain_step
+{
+};
+
+template <int step>
+using chain_t = strong_type<big_int<16>, chain_step<step>, multipliable>;
+using factor_t = strong_type<big_int<16>, struct factor_tag, multipliable>;
+using start_t = chain_t<0>;
+
+#define HAND_SPECIALIZED_STEP(step)                      \
+    template <>                                          \
+    struct units_multiplied<chain_t<step>, factor_t>     \
+    {                                                    \
+        using type = chain_t<step + 1>;                  \
+    };
+
+// an empty tens digit gives the steps 0 to 9
+#define TEN_STEPS(tens)               \
+    HAND_SPECIALIZED_STEP(tens##0)    \
+    HAND_SPECIALIZED_STEP(tens##1)    \
+    HAND_SPECIALIZED_STEP(tens##2)    \
+    HAND_SPECIALIZED_STEP(tens##3)    \
+    HAND_SPECIALIZED_STEP(tens##4)    \
+    HAND_SPECIALIZED_STEP(tens##5)    \
+    HAND_SPECIALIZED_STEP(tens##6)    \
+    HAND_SPECIALIZED_STEP(tens##7)    \
+    HAND_SPECIALIZED_STEP(tens##8)    \
+    HAND_SPECIALIZED_STEP(tens##9)
+
+TEN_STEPS()
+TEN_STEPS(1)
+#if BENCH_CHAIN_LENGTH > 20
+TEN_STEPS(2)
+TEN_STEPS(3)
+#endif
+#if BENCH_CHAIN_LENGTH > 40
+TEN_STEPS(4)
+TEN_STEPS(5)
+TEN_STEPS(6)
+TEN_STEPS(7)
+#endif
+
+#undef TEN_STEPS
+#undef HAND_SPECIALIZED_STEP
+
+#else
+
+using start_t =
+    strong_type<big_int<16>, dimensions::dimensionless, multipliable>;
+using factor_t = strong_type<big_int<16>, dimensions::length, multipliable>;
+
+#endif  // BENCH_HAND_SPECIALIZED
+
+// not static, so the chain is instantiated and compiled to code
+big_int<16> dimension_chain(const big_int<16>& value);
+
+big_int<16> dimension_chain(const big_int<16>& value)
+{
+    return product_chain(start_t(value), factor_t(value),
+                         std::make_index_sequence<BENCH_CHAIN_LENGTH>())
+        .value;
+}
@@ -0,0 +1,25 @@
+#include "bench.hpp"
+
+#include <cstdio>
+#include <cstring>
+
+// Runs every suite, or only the ones whose name contains the argument
+//     ./benchmarks big_rational
+int main(int argc, char** argv)
+{
+#ifndef NDEBUG
+    std::printf("not an optimized build, configure with "
+                "-DCMAKE_BUILD_TYPE=Release for meaningful numbers\n");
+#endif
+    const char* filter = argc > 1 ? argv[1] : "";
+    for (const auto& [name, suite] : bench::suites())
+    {
+        if (std::strstr(name, filter) == nullptr)
+        {
+            continue;
+        }
+        std::printf("%s\n", name);
+        suite();
+    }
+    return 0;
+}
@@ -0,0 +1,176 @@
+#include "bench.hpp"
+
+#include "big_int.hpp"
+#include "big_int_atomic.hpp"
+#include "si_executor.hpp"
+#include "si_parallel.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <mutex>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+#ifdef ENABLE_SI_PARALLEL
+
+static std::vector<big_int<32>> random_numbers(size_t count)
+{
+    std::vector<big_int<32>> res(count);
+    u32 state = 1;
+    for (auto& number : res)
+    {
+        for (auto& byte : number.raw)
+        {
+            state = state * 1'103'515'245U + 12'345U;
+            byte = u8(state >> 16);
+        }
+    }
+    return res;
+}
+
+BENCH_SUITE("parallel algorithms")
+{
+    const std::vector<big_int<32>> numbers = random_numbers(1 << 16);
+    si::parallel::thread_pool pool;
+    si::parallel::inline_executor inline_exec;
+
+    bench::measure("reduce 64k x 32 bytes, thread_pool", 20,
+                   [&]
+                   {
+                       bench::do_not_optimize(si::parallel::reduce(
+                           pool, numbers.begin(), numbers.end(),
+                           big_int<32>(), std::plus<>()));
+                   });
+    bench::measure("reduce 64k x 32 bytes, inline_executor", 20,
+                   [&]
+                   {
+                       bench::do_not_optimize(si::parallel::reduce(
+                           inline_exec, numbers.begin(), numbers.end(),
+                           big_int<32>(), std::plus<>()));
+                   });
+    bench::measure("reduce 64k x 32 bytes, std::accumulate", 20,
+                   [&]
+                   {
+                       bench::do_not_optimize(std::accumulate(
+                           numbers.begin(), numbers.end(), big_int<32>()));
+                   });
+
+    std::vector<big_int<32>> sorted;
+    bench::measure("sort 64k x 32 bytes, thread_pool", 5,
+                   [&]
+                   {
+                       sorted = numbers;
+                       si::parallel::sort(pool, sorted.begin(), sorted.end(),
+                                          std::less<>());
+                       bench::do_not_optimize(sorted);
+                   });
+    bench::measure("sort 64k x 32 bytes, std::stable_sort", 5,
+                   [&]
+                   {
+                       sorted = numbers;
+                       std::stable_sort(sorted.begin(), sorted.end());
+                       bench::do_not_optimize(sorted);
+                   });
+}
+
+// the cost of a task, an empty body at grain 64 over 64k indices makes
+// 1024 tasks which do nothing else
+BENCH_SUITE("parallel_for")
+{
+    constexpr size_t indices = 1 << 16;
+    constexpr size_t grain = 64;
+    constexpr size_t tasks = indices / grain;
+    // four threads even on fewer cores, a pool of one thread runs every
+    // job inline
+    si::parallel::thread_pool pool(4);
+    si::parallel::inline_executor inline_exec;
+
+    const auto empty_loop = [&](si::parallel::executor& exec)
+    {
+        return [&exec]
+        {
+            si::parallel::parallel_for(exec, 0, indices, grain,
+                                       [](size_t i)
+                                       { bench::do_not_optimize(i); });
+        };
+    };
+
+    bench::report("empty task, grain 64, thread_pool(4)",
+                  bench::best_ns(20, empty_loop(pool)) / tasks);
+    bench::report("empty task, grain 64, inline_executor",
+                  bench::best_ns(20, empty_loop(inline_exec)) / tasks);
+}
+
+// adds from threads running at once, the wall time is divided by all the
+// adds, so it falls with the threads while the adds run in parallel and
+// rises when they contend
+template <typename Add>
+static double contended_ns(size_t threads, size_t adds, const Add& add)
+{
+    return bench::best_ns(1,
+                          [&]
+                          {
+                              std::vector<std::thread> running;
+                              for (size_t t = 0; t < threads; ++t)
+                              {
+                                  running.emplace_back(
+                                      [&]
+                                      {
+                                          for (size_t i = 0; i < adds; ++i)
+                                          {
+                                              add();
+                                          }
+                                      });
+                              }
+                              for (std::thread& thread : running)
+                              {
+                                  thread.join();
+                              }
+                          }) /
+           double(threads * adds);
+}
+
+template <typename Add>
+static void thread_sweep(const char* counter_name, const Add& add)
+{
+    constexpr size_t adds = 20'000;
+    constexpr size_t max_threads = 64;
+    for (size_t threads = 1; threads <= max_threads; threads *= 2)
+    {
+        char name[96];
+        std::snprintf(name, sizeof(name), "%s, %zu thread%s", counter_name,
+                      threads, threads == 1 ? "" : "s");
+        bench::report(name, contended_ns(threads, adds, add));
+    }
+}
+
+// the lock-free and sharded counters only pay off when several cores
+// contend for the counter, on a single core the threads take turns
+BENCH_SUITE("atomic counters")
+{
+    const big_int<16> one = 1;
+    const big_int<32> wide_one = 1;
+
+    atomic_big_int<16> cas_counter;
+    atomic_big_int<32> locked_counter;
+    sharded_counter<16> sharded;
+    std::mutex mutex;
+    big_int<16> guarded;
+
+    thread_sweep("atomic_big_int<16>::fetch_add",
+                 [&] { bench::do_not_optimize(cas_counter.fetch_add(one)); });
+    thread_sweep(
+        "atomic_big_int<32>::fetch_add",
+        [&] { bench::do_not_optimize(locked_counter.fetch_add(wide_one)); });
+    thread_sweep("sharded_counter<16>::add", [&] { sharded.add(one); });
+    thread_sweep("big_int<16> under std::mutex",
+                 [&]
+                 {
+                     const std::lock_guard<std::mutex> lock(mutex);
+                     guarded += one;
+                 });
+    bench::do_not_optimize(guarded);
+}
+
+#endif  // ENABLE_SI_PARALLEL
@@ -0,0 +1,186 @@
+#include "bench.hpp"
+
+#include "big_int.hpp"
+#include "strong_decorators.hpp"
+#include "strong_dimensions.hpp"
+#include "strong_type.hpp"
+#include "strong_units.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <ratio>
+#include <vector>
+
+using length_t = strong_type<big_int<128>, struct bench_length_tag, addable>;
+
+// the strong type should copy like its value type, as one block of memory
+BENCH_SUITE("strong_type copies")
+{
+    constexpr size_t count = 4'096;
+    const std::vector<big_int<128>> numbers(count, big_int<128>(12'345));
+    const std::vector<length_t> lengths(count, length_t(big_int<128>(12'345)));
+    std::vector<big_int<128>> number_copies(count);
+    std::vector<length_t> length_copies(count, length_t(big_int<128>()));
+
+    bench::measure("std::copy 4096 x big_int<128>", 1'000,
+                   [&]
+                   {
+                       std::copy(numbers.begin(), numbers.end(),
+                                 number_copies.begin());
+                       bench::do_not_optimize(number_copies);
+                   });
+    bench::measure("std::copy 4096 x strong_type<big_int<128>>", 1'000,
+                   [&]
+                   {
+                       std::copy(lengths.begin(), lengths.end(),
+                                 length_copies.begin());
+                       bench::do_not_optimize(length_copies);
+                   });
+    bench::measure("memcpy 4096 x strong_type<big_int<128>>", 1'000,
+                   [&]
+                   {
+                       std::memcpy(length_copies.data(), lengths.data(),
+                                   count * sizeof(length_t));
+                       bench::do_not_optimize(length_copies);
+                   });
+}
+
+// a growing vector relocates its elements, which is a plain memmove for a
+// trivially copyable element
+template <typename T>
+static void growth_case(const char* grow_name,
+                        const char* reserve_name,
+                        const T& element)
+{
+    constexpr size_t count = 4'096;
+    bench::measure(grow_name, 200,
+                   [&]
+                   {
+                       std::vector<T> grown;
+                       for (size_t i = 0; i < count; ++i)
+                       {
+                           grown.push_back(element);
+                       }
+                       bench::do_not_optimize(grown);
+                   });
+    bench::measure(reserve_name, 200,
+                   [&]
+                   {
+                       std::vector<T> reserved;
+                       reserved.reserve(count);
+                       for (size_t i = 0; i < count; ++i)
+                       {
+                           reserved.push_back(element);
+                       }
+                       bench::do_not_optimize(reserved);
+                   });
+}
+
+BENCH_SUITE("strong_type vector growth")
+{
+    growth_case("push_back 4096 x big_int<128>",
+                "reserve, push_back 4096 x big_int<128>",
+                big_int<128>(12'345));
+    growth_case("push_back 4096 x strong_type<big_int<128>>",
+                "reserve, push_back 4096 x strong_type<big_int<128>>",
+                length_t(big_int<128>(12'345)));
+}
+
+template <typename dimension_t>
+using quantity_t =
+    strong_type<big_int<32>, dimension_t, addable, multipliable, dividable>;
+
+// the dimensions are resolved at compile time, so the products should cost
+// what the products of the values cost
+BENCH_SUITE("dimension products")
+{
+    constexpr size_t count = 1'024;
+    std::vector<quantity_t<dimensions::force>> forces;
+    std::vector<quantity_t<dimensions::length>> distances;
+    std::vector<big_int<32>> raw_forces;
+    std::vector<big_int<32>> raw_distances;
+    for (size_t i = 0; i < count; ++i)
+    {
+        raw_forces.emplace_back(int(i * 7 + 1));
+        raw_distances.emplace_back(int(i * 3 + 2));
+        forces.emplace_back(raw_forces.back());
+        distances.emplace_back(raw_distances.back());
+    }
+
+    bench::measure("1024 x newton * meter, big_int<32>", 100,
+                   [&]
+                   {
+                       for (size_t i = 0; i < count; ++i)
+                       {
+                           bench::do_not_optimize(forces[i] * distances[i]);
+                       }
+                   });
+    bench::measure("1024 x raw big_int<32> products", 100,
+                   [&]
+                   {
+                       for (size_t i = 0; i < count; ++i)
+                       {
+                           bench::do_not_optimize(raw_forces[i] *
+                                                  raw_distances[i]);
+                       }
+                   });
+}
+
+template <typename unit_t>
+using unit_quantity_t = strong_type<big_int<32>, unit_t, addable>;
+
+using meter_t = unit_quantity_t<dimensions::length>;
+using kilometer_t = unit_quantity_t<prefixed_t<std::kilo, dimensions::length>>;
+using millimeter_t =
+    unit_quantity_t<prefixed_t<std::milli, dimensions::length>>;
+
+// the factor between the units is folded at compile time, so a conversion
+// is a single product by a constant, even across two prefixes
+BENCH_SUITE("quantity_cast")
+{
+    constexpr size_t count = 1'024;
+    std::vector<kilometer_t> distances;
+    std::vector<big_int<32>> raw_distances;
+    for (size_t i = 0; i < count; ++i)
+    {
+        raw_distances.emplace_back(int(i * 13 + 1));
+        distances.emplace_back(raw_distances.back());
+    }
+    const big_int<32> thousand = 1'000;
+
+    bench::measure("1024 x quantity_cast km to m", 100,
+                   [&]
+                   {
+                       for (const kilometer_t& distance : distances)
+                       {
+                           bench::do_not_optimize(
+                               quantity_cast<meter_t>(distance));
+                       }
+                   });
+    bench::measure("1024 x raw big_int<32> * 1000", 100,
+                   [&]
+                   {
+                       for (const big_int<32>& distance : raw_distances)
+                       {
+                           bench::do_not_optimize(distance * thousand);
+                       }
+                   });
+    bench::measure("1024 x quantity_cast km to mm", 100,
+                   [&]
+                   {
+                       for (const kilometer_t& distance : distances)
+                       {
+                           bench::do_not_optimize(
+                               quantity_cast<millimeter_t>(distance));
+                       }
+                   });
+    bench::measure("1024 x quantity_cast km to m to mm", 100,
+                   [&]
+                   {
+                       for (const kilometer_t& distance : distances)
+                       {
+                           bench::do_not_optimize(quantity_cast<millimeter_t>(
+                               quantity_cast<meter_t>(distance)));
+                       }
+                   });
+}
@@ -1,12 +1,16 @@
 # Options
 option(ENABLE_SANDBOX "Should the sandbox project be included" ON)
 option(ENABLE_TESTING "Should the test project be included" OFF)
+option(ENABLE_BENCHMARKS "Should the microbenchmark project be included" OFF)
 option(WARNINGS_AS_ERRORS "Treat compiler warnings as errors" ON)
 option(ENABLE_CLANG_TIDY "Enable static analysis with clang-tidy" OFF)
 option(ENABLE_SI_CONSTANTS "The library provides big_int definitions for the SI constants" OFF)
 option(ENABLE_BIG_INT_STD_INTEGRATION "Enable integration with C++ standard library" OFF)
 option(ENABLE_BIG_INT_UTIL "Enable utilities for the big_int" OFF)
 option(ENABLE_BIG_INT_LITERAL "Enable the custom compile time literal for big_int" OFF)
+option(ENABLE_BIG_INT_BATCH "Enable the batched kernels over arrays of big_int" OFF)
+option(ENABLE_SI_PARALLEL "Enable the parallel algorithms, links the threads library" OFF)
+option(ENABLE_BIG_INT_EXPR "Enable the lazy big_int expressions evaluated in a single pass" OFF)
 
 if(ENABLE_SI_CONSTANTS)
   add_compile_definitions(DEFINE_SI_CONSTANTS)
@@ -23,3 +27,15 @@ endif()
 if(ENABLE_BIG_INT_LITERAL)
   add_compile_definitions(ENABLE_BIG_INT_LITERAL)
 endif()
+
+if(ENABLE_BIG_INT_BATCH)
+  add_compile_definitions(ENABLE_BIG_INT_BATCH)
+endif()
+
+if(ENABLE_SI_PARALLEL)
+  add_compile_definitions(ENABLE_SI_PARALLEL)
+endif()
+
+if(ENABLE_BIG_INT_EXPR)
+  add_compile_definitions(ENABLE_BIG_INT_EXPR)
+endif()
@@ -89,6 +89,37 @@ constexpr static T abs(T val) noexcept
 //         raw[i] = sign ? full_mask : empty_mask;
 //     }
 // }
+
+// Built-in integers which fit in a single 64 bit limb, bool is left to the
+// conversion
+template <typename T>
+using if_limb_t =
+    typename std::enable_if<std::is_integral<T>::value &&
+                            !std::is_same<T, bool>::value &&
+                            sizeof(T) <= sizeof(u64)>::type;
+
+// One column of a truncated product in Comba's product scanning, the sum of
+// a[i] * b[column - i], only the first a_len and b_len bytes can be non-zero
+// Fused sums of products add the columns of all of their terms in a single
+// pass over the destination
+template <size_t a_size, size_t b_size>
+BIG_INT_NODISCARD constexpr static u64 product_column(
+    const std::array<u8, a_size>& a,
+    size_t a_len,
+    const std::array<u8, b_size>& b,
+    size_t b_len,
+    size_t column) noexcept
+{
+    const size_t first = column < b_len ? 0 : column + 1 - b_len;
+    const size_t last = column < a_len ? column + 1 : a_len;
+
+    u64 sum = 0;
+    for (size_t i = first; i < last; ++i)
+    {
+        sum += u32(a[i]) * u32(b[column - i]);
+    }
+    return sum;
+}
 }  // namespace detail
 
 // Integer representation in size number of bytes
@@ -118,8 +149,17 @@ struct big_int
         return *this;
     }
 
-    // TODO : converting constructor from smaller big_ints
+    // Sign extends from smaller big_ints and truncates bigger ones
     // TODO : add feature switch for lossy conversions
+    template <size_t other_size>
+    constexpr explicit big_int(const big_int<other_size>& other) noexcept
+    {
+        const u8 extension = other.is_negative() ? u8(~0) : u8(0);
+        for (size_t i = 0; i < size; ++i)
+        {
+            raw[i] = i < other_size ? other.raw[i] : extension;
+        }
+    }
 
 #pragma region comparison_ops
     // TODO: compare with big_ints of different size
@@ -234,6 +274,37 @@ struct big_int
 
 #pragma endregion
 
+#pragma region bit_access
+    BIG_INT_NODISCARD constexpr bool test_bit(size_t bit_idx) const noexcept
+    {
+        return is_bit_set(bit_idx / 8, u8(bit_idx % 8));
+    }
+
+    constexpr void set_bit(size_t bit_idx) noexcept
+    {
+        raw[bit_idx / 8] = u8(raw[bit_idx / 8] | (1U << (bit_idx % 8)));
+    }
+
+    // The count of bits needed to hold the two's complement pattern when it
+    // is read as unsigned, so negative numbers always use all of the bits
+    BIG_INT_NODISCARD constexpr size_t bit_width() const noexcept
+    {
+        for (size_t i = size - 1; i < size; --i)
+        {
+            if (raw[i] != 0)
+            {
+                size_t width = i * 8;
+                for (u8 byte = raw[i]; byte != 0; byte = u8(byte >> 1))
+                {
+                    ++width;
+                }
+                return width;
+            }
+        }
+        return 0;
+    }
+#pragma endregion
+
     // Prefix oeprator ++
     constexpr big_int& operator++() noexcept
     {
@@ -266,6 +337,12 @@ struct big_int
 
     constexpr big_int& operator+=(const big_int& other) noexcept
     {
+        if constexpr (size >= lookahead_threshold)
+        {
+            add_lookahead(other);
+            return *this;
+        }
+
         bool carry = false;
         for (size_t i = 0; i < size; ++i)
         {
@@ -328,8 +405,56 @@ struct big_int
         return *this;
     }
 
-    constexpr big_int& operator/=(const big_int& other);
-    constexpr big_int& operator%=(const big_int& other);
+    // Truncates towards zero like the built-in integers
+    constexpr big_int& operator/=(const big_int& other)
+    {
+        big_int remainder;
+        divide(*this, other, *this, remainder);
+        return *this;
+    }
+
+    // By a built-in integer, the factor stays a single limb instead of being
+    // converted to a big_int for the full multiplication
+    template <typename T, typename = detail::if_limb_t<T>>
+    constexpr big_int& operator*=(T factor) noexcept
+    {
+        multiply_limb(magnitude_of(factor));
+        if (is_negative_limb(factor))
+        {
+            negate();
+        }
+        return *this;
+    }
+
+    // Truncates towards zero, short division by the single limb
+    template <typename T, typename = detail::if_limb_t<T>>
+    constexpr big_int& operator/=(T divisor)
+    {
+        if (divisor == 0)
+        {
+            throw std::domain_error("Division by zero!");
+        }
+
+        const bool negative_dividend = is_negative();
+        if (negative_dividend)
+        {
+            negate();
+        }
+        divide_limb(magnitude_of(divisor));
+        if (negative_dividend != is_negative_limb(divisor))
+        {
+            negate();
+        }
+        return *this;
+    }
+
+    // The remainder has the sign of the dividend like the built-in integers
+    constexpr big_int& operator%=(const big_int& other)
+    {
+        big_int quotient;
+        divide(*this, other, quotient, *this);
+        return *this;
+    }
 
     constexpr big_int& operator&=(const big_int& other) noexcept
     {
@@ -397,50 +522,78 @@ struct big_int
         // 5.
         // https://projecteuclid.org/journals/annals-of-mathematics/volume-193/issue-2/Integer-multiplication-in-time-Onmathrmlog-n/10.4007/annals.2021.193.2.4.short
 
-        // big_int res = 0;
-
-        // big_int summand = other;
+        // Schoolbook multiplication over the bytes. The product is truncated
+        // to size bytes, so the two's complement operands need no special
+        // handling of the sign.
+        // Only the significant bytes take part, so the cost follows the
+        // lengths of the operands rather than the size.
+        big_int res;
 
-        // for (size_t byte_idx = 0; byte_idx < size; ++byte_idx)
-        //{
-        //    for (u8 bit_idx = 0; bit_idx < 8;
-        //         ++bit_idx, summand.left_shift_once())
-        //    {
-        //        if (is_bit_set(byte_idx, bit_idx))
-        //        {
-        //            res += summand;
-        //        }
-        //    }
-        //}
+        const size_t this_len = (bit_width() + 7) / 8;
+        const size_t other_len = (other.bit_width() + 7) / 8;
 
-        big_int res = 0;
+        for (size_t i = 0; i < this_len; ++i)
+        {
+            if (raw[i] == 0)
+            {
+                continue;
+            }
 
-        const bool should_negate = other.is_negative();
+            const size_t row_len = other_len < size - i ? other_len : size - i;
 
-        const big_int abs_other = other.is_negative() ? -other : other;
+            u32 carry = 0;
+            for (size_t j = 0; j < row_len; ++j)
+            {
+                const u32 partial = u32(res.raw[i + j]) +
+                                    u32(raw[i]) * u32(other.raw[j]) + carry;
+                res.raw[i + j] = u8(partial);
+                carry = partial >> 8;
+            }
 
-        for (big_int i = 0; i < abs_other; ++i)
-        {
-            res += *this;
+            // the previous rows did not reach this byte yet
+            if (i + row_len < size)
+            {
+                res.raw[i + row_len] = u8(carry);
+            }
         }
 
-        if (should_negate)
-        {
-            res.negate();
-        }
         return res;
     }
 
     BIG_INT_NODISCARD constexpr big_int operator/(
-        const big_int& other) const noexcept
+        const big_int& other) const
     {
         big_int res = *this;
         res /= other;
         return res;
     }
 
+    template <typename T, typename = detail::if_limb_t<T>>
+    BIG_INT_NODISCARD constexpr big_int operator*(T factor) const noexcept
+    {
+        big_int res = *this;
+        res *= factor;
+        return res;
+    }
+
+    template <typename T, typename = detail::if_limb_t<T>>
+    BIG_INT_NODISCARD friend constexpr big_int operator*(
+        T factor,
+        const big_int& number) noexcept
+    {
+        return number * factor;
+    }
+
+    template <typename T, typename = detail::if_limb_t<T>>
+    BIG_INT_NODISCARD constexpr big_int operator/(T divisor) const
+    {
+        big_int res = *this;
+        res /= divisor;
+        return res;
+    }
+
     BIG_INT_NODISCARD constexpr big_int operator%(
-        const big_int& other) const noexcept
+        const big_int& other) const
     {
         big_int res = *this;
         res %= other;
@@ -563,51 +716,105 @@ private:
         static_assert(size >= sizeof(T),
                       "The size of the big int must be greater than the size "
                       "of the source type");
-        // This relies too much on representation
-        // TODO : Detect representation
-        // detail::sign_extend_into(raw, detail::bytes_of<T>(a));
-
-        if (a == 0)
-        {
-            return;
-        }
-
-        const bool should_negate = a < 0;
-        a = detail::abs<T>(a);
-
-        if ((a % T(2)) == 0)
+        // The conversion to the unsigned type is defined modulo 2^N, so this
+        // gives the two's complement bytes regardless of the representation
+        if constexpr (std::is_same<T, bool>::value)
         {
-            increment();
-            increment();
-            a = T(a - T(2));
+            raw = {0};
+            raw[0] = u8(a);
         }
         else
         {
-            increment();
-            a = T(a - T(1));
+            using unsigned_t = typename std::make_unsigned<T>::type;
+            const unsigned_t bits = static_cast<unsigned_t>(a);
+            const u8 extension = a < 0 ? u8(~0) : u8(0);
+
+            for (size_t i = 0; i < size; ++i)
+            {
+                raw[i] = i < sizeof(T) ? u8(bits >> (i * 8)) : extension;
+            }
         }
+    }
+
+#pragma region arithmetic_helpers
+    // From this size on the carries are resolved with a parallel prefix
+    static constexpr size_t lookahead_threshold = 32;
 
-        while (a != 0)
+    // Written out byte by byte, so the compilers merge them to a single
+    // load or store
+    BIG_INT_NODISCARD constexpr u64 word(size_t word_idx) const noexcept
+    {
+        const u8* bytes = raw.data() + word_idx * 8;
+        return u64(bytes[0]) | u64(bytes[1]) << 8 | u64(bytes[2]) << 16 |
+               u64(bytes[3]) << 24 | u64(bytes[4]) << 32 |
+               u64(bytes[5]) << 40 | u64(bytes[6]) << 48 |
+               u64(bytes[7]) << 56;
+    }
+
+    constexpr void set_word(size_t word_idx, u64 value) noexcept
+    {
+        u8* bytes = raw.data() + word_idx * 8;
+        bytes[0] = u8(value);
+        bytes[1] = u8(value >> 8);
+        bytes[2] = u8(value >> 16);
+        bytes[3] = u8(value >> 24);
+        bytes[4] = u8(value >> 32);
+        bytes[5] = u8(value >> 40);
+        bytes[6] = u8(value >> 48);
+        bytes[7] = u8(value >> 56);
+    }
+
+    // Carry-lookahead addition
+    // The bytes are summed as words of 8 bytes without the carries, bit w of
+    // generate marks the words that overflowed and bit w of propagate the
+    // ones that pass an incoming carry on, then the carries of 64 words are
+    // resolved in 6 Kogge-Stone steps instead of rippling through every byte
+    constexpr void add_lookahead(const big_int& other) noexcept
+    {
+        constexpr size_t words = size / 8;
+        constexpr size_t block = words < 64 ? words : 64;
+
+        std::array<u64, block> sums = {0};
+        u64 carry = 0;
+        for (size_t first = 0; first < words; first += block)
         {
-            if ((a % T(2)) == 0)
+            const size_t count =
+                words - first < block ? words - first : block;
+
+            u64 generate = 0;
+            u64 propagate = 0;
+            for (size_t w = 0; w < count; ++w)
             {
-                left_shift_once();
-                a = T(a / T(2));
+                const u64 a = word(first + w);
+                sums[w] = a + other.word(first + w);
+                generate |= u64(sums[w] < a) << w;
+                propagate |= u64(sums[w] == ~u64(0)) << w;
             }
-            else
+
+            generate |= propagate & carry;
+            for (size_t shift = 1; shift < block; shift *= 2)
             {
-                increment();
-                --a;
+                generate |= propagate & (generate << shift);
+                propagate &= propagate << shift;
             }
+
+            // bit w of generate is now the carry out of word w
+            const u64 carries_in = (generate << 1) | carry;
+            for (size_t w = 0; w < count; ++w)
+            {
+                set_word(first + w, sums[w] + ((carries_in >> w) & 1));
+            }
+            carry = (generate >> (count - 1)) & 1;
         }
 
-        if (should_negate)
+        for (size_t i = words * 8; i < size; ++i)
         {
-            negate();
+            const u64 sum = raw[i] + u64(other.raw[i]) + carry;
+            raw[i] = u8(sum);
+            carry = sum >> 8;
         }
     }
 
-#pragma region arithmetic_helpers
     // Increments the number by one
     constexpr void increment() noexcept
     {
@@ -641,6 +848,252 @@ private:
         // TODO: if the curr_idx is size, then there is underflow
         // maybe make it configurable so it throws
     }
+
+    template <typename T>
+    BIG_INT_NODISCARD constexpr static bool is_negative_limb(T number) noexcept
+    {
+        if constexpr (std::is_signed<T>::value)
+        {
+            return number < 0;
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    // The conversion to the unsigned type is modulo 2^N, so the magnitude of
+    // the minimal value is right as well
+    template <typename T>
+    BIG_INT_NODISCARD constexpr static u64 magnitude_of(T number) noexcept
+    {
+        using unsigned_t = typename std::make_unsigned<T>::type;
+        const unsigned_t bits = unsigned_t(number);
+        return is_negative_limb(number) ? u64(unsigned_t(~bits + 1U))
+                                        : u64(bits);
+    }
+
+    // Factors of up to 32 bits take one multiplication per byte in place,
+    // wider ones sum the columns of the at most 8 bytes of the factor
+    // The bytes past the operand stay zero once the carry is gone
+    constexpr void multiply_limb(u64 factor) noexcept
+    {
+        const size_t len = (bit_width() + 7) / 8;
+        if (factor <= 0xFFFF'FFFFU)
+        {
+            u64 carry = 0;
+            for (size_t i = 0; i < size && (i < len || carry != 0); ++i)
+            {
+                carry += u64(raw[i]) * factor;
+                raw[i] = u8(carry);
+                carry >>= 8;
+            }
+            return;
+        }
+
+        std::array<u8, sizeof(u64)> limb = {0};
+        for (size_t i = 0; i < sizeof(u64); ++i)
+        {
+            limb[i] = u8(factor >> (i * 8));
+        }
+
+        big_int res;
+        u64 carry = 0;
+        for (size_t i = 0; i < size; ++i)
+        {
+            carry += detail::product_column(raw, len, limb, sizeof(u64), i);
+            res.raw[i] = u8(carry);
+            carry >>= 8;
+        }
+        *this = res;
+    }
+
+    // Unsigned short division of the bit pattern, the partial remainders fit
+    // in 64 bits for divisors below 2^56, the rest go to divide_magnitudes
+    constexpr void divide_limb(u64 divisor) noexcept
+    {
+        if (divisor >> 56 != 0)
+        {
+            if constexpr (size >= sizeof(u64))
+            {
+                big_int v;
+                for (size_t i = 0; i < sizeof(u64); ++i)
+                {
+                    v.raw[i] = u8(divisor >> (i * 8));
+                }
+                const big_int u = *this;
+                big_int remainder;
+                divide_magnitudes(u, v, *this, remainder);
+            }
+            else
+            {
+                // the magnitude is below 2^(8 * size), so below the divisor
+                *this = zero();
+            }
+            return;
+        }
+
+        const size_t len = (bit_width() + 7) / 8;
+        u64 rem = 0;
+        for (size_t i = len - 1; i < len; --i)
+        {
+            const u64 current = (rem << 8) | raw[i];
+            raw[i] = u8(current / divisor);
+            rem = current % divisor;
+        }
+    }
+
+    // Truncating division, the quotient and remainder may alias the operands
+    constexpr static void divide(const big_int& dividend,
+                                 const big_int& divisor,
+                                 big_int& quotient,
+                                 big_int& remainder)
+    {
+        if (!divisor)
+        {
+            throw std::domain_error("Division by zero!");
+        }
+
+        const bool negative_dividend = dividend.is_negative();
+        const bool negative_divisor = divisor.is_negative();
+
+        // the magnitude of the minimal value is still correct when it is read
+        // as unsigned, so the negation cannot overflow here
+        const big_int u = negative_dividend ? -dividend : dividend;
+        const big_int v = negative_divisor ? -divisor : divisor;
+
+        divide_magnitudes(u, v, quotient, remainder);
+
+        if (negative_dividend != negative_divisor)
+        {
+            quotient.negate();
+        }
+        if (negative_dividend)
+        {
+            remainder.negate();
+        }
+    }
+
+    // Unsigned division of the bit patterns
+    // Short division for single byte divisors and Knuth's algorithm D
+    // (TAOCP vol. 2, 4.3.1) over the bytes otherwise
+    constexpr static void divide_magnitudes(const big_int& u,
+                                            const big_int& v,
+                                            big_int& quotient,
+                                            big_int& remainder) noexcept
+    {
+        const size_t u_len = (u.bit_width() + 7) / 8;
+        const size_t v_len = (v.bit_width() + 7) / 8;
+
+        quotient = zero();
+        remainder = zero();
+
+        if (u_len < v_len)
+        {
+            remainder = u;
+            return;
+        }
+
+        if (v_len == 1)
+        {
+            const u32 divisor = v.raw[0];
+            u32 rem = 0;
+            for (size_t i = u_len - 1; i < u_len; --i)
+            {
+                const u32 current = (rem << 8) | u.raw[i];
+                quotient.raw[i] = u8(current / divisor);
+                rem = current % divisor;
+            }
+            remainder.raw[0] = u8(rem);
+            return;
+        }
+
+        // normalize so the most significant byte of the divisor has its top
+        // bit set, which keeps the quotient estimate off by at most 2
+        u32 shift = 0;
+        while (((u32(v.raw[v_len - 1]) << shift) & 0x80U) == 0)
+        {
+            ++shift;
+        }
+
+        std::array<u8, size> vn = {0};
+        std::array<u8, size + 1> un = {0};
+        for (size_t i = v_len - 1; i > 0; --i)
+        {
+            vn[i] = u8((u32(v.raw[i]) << shift) |
+                        (v.raw[i - 1] >> (8 - shift)));
+        }
+        vn[0] = u8(u32(v.raw[0]) << shift);
+
+        un[u_len] = u8(u.raw[u_len - 1] >> (8 - shift));
+        for (size_t i = u_len - 1; i > 0; --i)
+        {
+            un[i] = u8((u32(u.raw[i]) << shift) |
+                        (u.raw[i - 1] >> (8 - shift)));
+        }
+        un[0] = u8(u32(u.raw[0]) << shift);
+
+        const u32 v_top = vn[v_len - 1];
+        const u32 v_next = vn[v_len - 2];
+
+        for (size_t j = u_len - v_len; j <= u_len - v_len; --j)
+        {
+            const u32 numerator =
+                (u32(un[j + v_len]) << 8) | un[j + v_len - 1];
+            u32 q_hat = numerator / v_top;
+            u32 r_hat = numerator % v_top;
+
+            while (q_hat > 0xFF ||
+                   q_hat * v_next > ((r_hat << 8) | un[j + v_len - 2]))
+            {
+                --q_hat;
+                r_hat += v_top;
+                if (r_hat > 0xFF)
+                {
+                    break;
+                }
+            }
+
+            // multiply and subtract
+            u32 borrow = 0;
+            for (size_t i = 0; i < v_len; ++i)
+            {
+                const u32 product = q_hat * vn[i] + borrow;
+                const u8 subtrahend = u8(product);
+                borrow = product >> 8;
+                if (un[i + j] < subtrahend)
+                {
+                    ++borrow;
+                }
+                un[i + j] = u8(un[i + j] - subtrahend);
+            }
+
+            const bool overshot = un[j + v_len] < borrow;
+            un[j + v_len] = u8(un[j + v_len] - borrow);
+
+            // the estimate was one too big, add the divisor back
+            if (overshot)
+            {
+                --q_hat;
+                u32 carry = 0;
+                for (size_t i = 0; i < v_len; ++i)
+                {
+                    const u32 sum = u32(un[i + j]) + vn[i] + carry;
+                    un[i + j] = u8(sum);
+                    carry = sum >> 8;
+                }
+                un[j + v_len] = u8(un[j + v_len] + carry);
+            }
+
+            quotient.raw[j] = u8(q_hat);
+        }
+
+        for (size_t i = 0; i < v_len; ++i)
+        {
+            remainder.raw[i] =
+                u8((un[i] >> shift) | (u32(un[i + 1]) << (8 - shift)));
+        }
+    }
 #pragma endregion
 
 #pragma region bitwise_helpers
@@ -0,0 +1,248 @@
+#pragma once
+
+#ifdef ENABLE_BIG_INT_UTIL
+
+#include "big_int.hpp"
+#include "strong_decorators.hpp"
+#include "strong_type.hpp"
+#include "util.hpp"
+
+#include <array>
+#include <type_traits>
+
+// Sums long streams of values without propagating the carries on every add
+// Every byte of the sum has its own 32 bit lane, so the lanes hold the sums
+// in a redundant carry-save form and add is a carry-free loop over the lanes
+// The carries are moved up when the value is read or when the next add could
+// overflow a lane
+template <typename T>
+class accumulator;
+
+template <size_t size>
+class accumulator<big_int<size>>
+{
+public:
+    using value_type = big_int<size>;
+
+    constexpr accumulator() noexcept = default;
+
+    constexpr explicit accumulator(const value_type& initial) noexcept
+    {
+        add(initial);
+    }
+
+    constexpr void add(const value_type& value) noexcept
+    {
+        if (pending == max_pending)
+        {
+            normalize();
+        }
+
+        for (size_t i = 0; i < size; ++i)
+        {
+            lanes[i] += value.raw[i];
+        }
+        ++pending;
+    }
+
+    constexpr accumulator& operator+=(const value_type& value) noexcept
+    {
+        add(value);
+        return *this;
+    }
+
+    // Adds a * b, the columns of the product go straight to the lanes, so
+    // the product is never stored and it counts as a single add
+    constexpr void mul_add(const value_type& a, const value_type& b) noexcept
+    {
+        add_product(a.raw, significant_bytes(a), b.raw, significant_bytes(b));
+    }
+
+    // Adds a * factor, the factor is a single unsigned 64 bit limb
+    constexpr void mul_add_small(const value_type& a, u64 factor) noexcept
+    {
+        std::array<u8, sizeof(u64)> limb = {0};
+        size_t limb_len = 0;
+        for (; factor != 0; factor >>= 8)
+        {
+            limb[limb_len++] = u8(factor);
+        }
+        add_product(a.raw, significant_bytes(a), limb, limb_len);
+    }
+
+    // The sum wraps like the repeated += on big_int would
+    BIG_INT_NODISCARD constexpr value_type value() const noexcept
+    {
+        value_type res;
+        u64 carry = 0;
+        for (size_t i = 0; i < size; ++i)
+        {
+            const u64 lane = lanes[i] + carry;
+            res.raw[i] = u8(lane);
+            carry = lane >> 8;
+        }
+        return res;
+    }
+
+private:
+    // Every add grows a lane by at most 0xFF and the normalization leaves
+    // single bytes in them, so this many adds always fit into 32 bits
+    static constexpr u32 max_pending = 0xFFFF'FFFFU / 0xFFU;
+
+    BIG_INT_NODISCARD constexpr static size_t significant_bytes(
+        const value_type& value) noexcept
+    {
+        return (value.bit_width() + 7) / 8;
+    }
+
+    // The operands are regrouped to 32 bit limbs, so a column takes a
+    // sixteenth of the byte products, and every 32x32 -> 64 bit partial
+    // product is split to halves summed per column (Comba's product
+    // scanning) like in multiply_many
+    // Every lane gets one byte of the product, the columns past the operands
+    // only carry, so the loop stops once the carry is gone
+    template <size_t b_size>
+    constexpr void add_product(const std::array<u8, size>& a,
+                               size_t a_len,
+                               const std::array<u8, b_size>& b,
+                               size_t b_len) noexcept
+    {
+        if (pending == max_pending)
+        {
+            normalize();
+        }
+
+        constexpr size_t limbs = (size + 3) / 4;
+        b_len = b_len < size ? b_len : size;
+        const size_t a_limbs = (a_len + 3) / 4;
+        const size_t b_limbs = (b_len + 3) / 4;
+
+        std::array<u32, limbs> x = {0};
+        std::array<u32, limbs> y = {0};
+        for (size_t i = 0; i < a_len; ++i)
+        {
+            x[i / 4] |= u32(a[i]) << (i % 4 * 8);
+        }
+        for (size_t i = 0; i < b_len; ++i)
+        {
+            y[i / 4] |= u32(b[i]) << (i % 4 * 8);
+        }
+
+        u64 carry = 0;
+        for (size_t column = 0;
+             column < limbs && (column < a_limbs + b_limbs || carry != 0);
+             ++column)
+        {
+            const size_t first = column < b_limbs ? 0 : column + 1 - b_limbs;
+            const size_t last = column < a_limbs ? column + 1 : a_limbs;
+
+            u64 low_sum = 0;
+            u64 high_sum = 0;
+            for (size_t i = first; i < last; ++i)
+            {
+                const u64 partial = u64(x[i]) * y[column - i];
+                low_sum += partial & 0xFFFF'FFFFU;
+                high_sum += partial >> 32;
+            }
+
+            const u64 total = carry + low_sum;
+            carry = (total >> 32) + high_sum;
+            for (size_t byte = 0; byte < 4 && column * 4 + byte < size; ++byte)
+            {
+                lanes[column * 4 + byte] += u8(total >> (byte * 8));
+            }
+        }
+        ++pending;
+    }
+
+    constexpr void normalize() noexcept
+    {
+        const value_type sum = value();
+        for (size_t i = 0; i < size; ++i)
+        {
+            lanes[i] = sum.raw[i];
+        }
+        pending = 1;
+    }
+
+    std::array<u32, size> lanes = {0};
+    u32 pending = 0;
+};
+
+namespace detail
+{
+template <typename Quantity, typename Identifier>
+struct is_quantity_of : std::false_type
+{
+};
+
+template <typename T,
+          typename Identifier,
+          template <typename>
+          typename... Decorators>
+struct is_quantity_of<strong_type<T, Identifier, Decorators...>, Identifier>
+    : std::true_type
+{
+};
+}  // namespace detail
+
+// Sums of strong types keep their unit, so adding a different unit does not
+// compile
+template <typename T,
+          typename Identifier,
+          template <typename>
+          typename... Decorators>
+class accumulator<strong_type<T, Identifier, Decorators...>>
+{
+public:
+    using value_type = strong_type<T, Identifier, Decorators...>;
+
+    static_assert(std::is_base_of<addable<value_type>, value_type>::value,
+                  "Only addable strong types can be accumulated!");
+
+    constexpr accumulator() noexcept = default;
+
+    constexpr explicit accumulator(const value_type& initial) noexcept
+        : sum(initial.value)
+    {
+    }
+
+    constexpr void add(const value_type& value) noexcept
+    {
+        sum.add(value.value);
+    }
+
+    constexpr accumulator& operator+=(const value_type& value) noexcept
+    {
+        add(value);
+        return *this;
+    }
+
+    // The product has to be of the unit of the sum, e.g. newtons times
+    // meters into joules, with the units from units_multiplied
+    template <typename A, typename B>
+    constexpr void mul_add(const A& a, const B& b) noexcept
+    {
+        static_assert(
+            detail::is_quantity_of<typename units_multiplied<A, B>::type,
+                                   Identifier>::value,
+            "The product is of a different unit than the sum!");
+        sum.mul_add(a.value, b.value);
+    }
+
+    // Scaling by a plain number keeps the unit
+    constexpr void mul_add_small(const value_type& a, u64 factor) noexcept
+    {
+        sum.mul_add_small(a.value, factor);
+    }
+
+    BIG_INT_NODISCARD constexpr value_type value() const noexcept
+    {
+        return value_type(sum.value());
+    }
+
+private:
+    accumulator<T> sum;
+};
+
+#endif  // ENABLE_BIG_INT_UTIL
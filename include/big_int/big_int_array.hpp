@@ -0,0 +1,321 @@
+#pragma once
+
+#ifdef ENABLE_BIG_INT_BATCH
+
+#include "big_int.hpp"
+#include "util.hpp"
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <new>
+#include <vector>
+
+namespace detail
+{
+template <typename T, size_t alignment>
+struct aligned_allocator
+{
+    using value_type = T;
+
+    template <typename U>
+    struct rebind
+    {
+        using other = aligned_allocator<U, alignment>;
+    };
+
+    constexpr aligned_allocator() noexcept = default;
+
+    template <typename U>
+    constexpr aligned_allocator(  // NOLINT(hicpp-explicit-conversions)
+        const aligned_allocator<U, alignment>&) noexcept
+    {
+    }
+
+    BIG_INT_NODISCARD T* allocate(size_t count)
+    {
+        return static_cast<T*>(
+            ::operator new(count * sizeof(T), std::align_val_t(alignment)));
+    }
+
+    void deallocate(T* ptr, size_t) noexcept
+    {
+        ::operator delete(ptr, std::align_val_t(alignment));
+    }
+
+    template <typename U>
+    BIG_INT_NODISCARD constexpr bool operator==(
+        const aligned_allocator<U, alignment>&) const noexcept
+    {
+        return true;
+    }
+
+    template <typename U>
+    BIG_INT_NODISCARD constexpr bool operator!=(
+        const aligned_allocator<U, alignment>&) const noexcept
+    {
+        return false;
+    }
+};
+}  // namespace detail
+
+// Structure of arrays storage for many big_ints of the same size
+// Limb k of every element is contiguous and every such row is aligned to a
+// cache line, so the kernels below run the same operation over consecutive
+// elements and the compiler can vectorize them across the elements
+template <size_t bi_size>
+class big_int_array
+{
+public:
+    static constexpr size_t alignment = 64;
+
+    big_int_array() = default;
+
+    explicit big_int_array(size_t count)
+        : elements(count),
+          row_stride(stride_for(count)),
+          limbs(bi_size * row_stride)
+    {
+    }
+
+    big_int_array(const big_int<bi_size>* first, size_t count)
+        : big_int_array(count)
+    {
+        load(first);
+    }
+
+    BIG_INT_NODISCARD size_t size() const noexcept { return elements; }
+
+    // The distance between two consecutive limbs of an element
+    BIG_INT_NODISCARD size_t stride() const noexcept { return row_stride; }
+
+    BIG_INT_NODISCARD u8* limb(size_t limb_idx) noexcept
+    {
+        return limbs.data() + limb_idx * row_stride;
+    }
+
+    BIG_INT_NODISCARD const u8* limb(size_t limb_idx) const noexcept
+    {
+        return limbs.data() + limb_idx * row_stride;
+    }
+
+    BIG_INT_NODISCARD big_int<bi_size> get(size_t idx) const noexcept
+    {
+        assert(idx < elements);
+        big_int<bi_size> res;
+        for (size_t k = 0; k < bi_size; ++k)
+        {
+            res.raw[k] = limb(k)[idx];
+        }
+        return res;
+    }
+
+    void set(size_t idx, const big_int<bi_size>& value) noexcept
+    {
+        assert(idx < elements);
+        for (size_t k = 0; k < bi_size; ++k)
+        {
+            limb(k)[idx] = value.raw[k];
+        }
+    }
+
+    // Keeps the first min(size(), count) elements, the new ones are zero
+    void resize(size_t count)
+    {
+        big_int_array resized(count);
+        const size_t kept = count < elements ? count : elements;
+        for (size_t k = 0; k < bi_size; ++k)
+        {
+            for (size_t i = 0; i < kept; ++i)
+            {
+                resized.limb(k)[i] = limb(k)[i];
+            }
+        }
+        *this = std::move(resized);
+    }
+
+    // Transposes size() elements from the array of structures in first
+    void load(const big_int<bi_size>* first) noexcept
+    {
+        for (size_t i = 0; i < elements; ++i)
+        {
+            set(i, first[i]);
+        }
+    }
+
+    // Transposes the elements to the array of structures in out
+    void store(big_int<bi_size>* out) const noexcept
+    {
+        for (size_t i = 0; i < elements; ++i)
+        {
+            out[i] = get(i);
+        }
+    }
+
+private:
+    static size_t stride_for(size_t count) noexcept
+    {
+        return (count + alignment - 1) / alignment * alignment;
+    }
+
+    size_t elements = 0;
+    size_t row_stride = 0;
+    std::vector<u8, detail::aligned_allocator<u8, alignment>> limbs;
+};
+
+namespace detail
+{
+// The carries are kept for a block of elements, so they stay in the cache
+// while the limbs are walked from the least significant to the most
+constexpr size_t batch_block = 256;
+
+template <size_t bi_size, typename limb_operation>
+static void batch_carry_kernel(const big_int_array<bi_size>& a,
+                               const big_int_array<bi_size>& b,
+                               big_int_array<bi_size>& out,
+                               u8 initial_carry,
+                               limb_operation operation) noexcept
+{
+    assert(a.size() == b.size() && a.size() == out.size());
+
+    std::array<u8, batch_block> carries{};
+    for (size_t first = 0; first < a.size(); first += batch_block)
+    {
+        const size_t count =
+            a.size() - first < batch_block ? a.size() - first : batch_block;
+        carries.fill(initial_carry);
+
+        for (size_t k = 0; k < bi_size; ++k)
+        {
+            const u8* a_limb = a.limb(k) + first;
+            const u8* b_limb = b.limb(k) + first;
+            u8* out_limb = out.limb(k) + first;
+            for (size_t i = 0; i < count; ++i)
+            {
+                const u32 sum = operation(a_limb[i], b_limb[i]) + carries[i];
+                out_limb[i] = u8(sum);
+                carries[i] = u8(sum >> 8);
+            }
+        }
+    }
+}
+
+template <size_t bi_size, typename limb_operation>
+static void batch_bitwise_kernel(const big_int_array<bi_size>& a,
+                                 const big_int_array<bi_size>& b,
+                                 big_int_array<bi_size>& out,
+                                 limb_operation operation) noexcept
+{
+    assert(a.size() == b.size() && a.size() == out.size());
+
+    // the padding up to the stride is processed too, it is never read
+    for (size_t k = 0; k < bi_size; ++k)
+    {
+        const u8* a_limb = a.limb(k);
+        const u8* b_limb = b.limb(k);
+        u8* out_limb = out.limb(k);
+        for (size_t i = 0; i < a.stride(); ++i)
+        {
+            out_limb[i] = operation(a_limb[i], b_limb[i]);
+        }
+    }
+}
+}  // namespace detail
+
+// out[i] = a[i] + b[i], out may alias a or b
+template <size_t bi_size>
+static void add(const big_int_array<bi_size>& a,
+                const big_int_array<bi_size>& b,
+                big_int_array<bi_size>& out) noexcept
+{
+    detail::batch_carry_kernel(a, b, out, u8(0),
+                               [](u8 x, u8 y) { return u32(x) + y; });
+}
+
+// out[i] = a[i] - b[i], computed as a[i] + ~b[i] + 1
+template <size_t bi_size>
+static void sub(const big_int_array<bi_size>& a,
+                const big_int_array<bi_size>& b,
+                big_int_array<bi_size>& out) noexcept
+{
+    detail::batch_carry_kernel(a, b, out, u8(1),
+                               [](u8 x, u8 y) { return u32(x) + u8(~y); });
+}
+
+// out[i] = -a[i]
+template <size_t bi_size>
+static void negate(const big_int_array<bi_size>& a,
+                   big_int_array<bi_size>& out) noexcept
+{
+    detail::batch_carry_kernel(a, a, out, u8(1),
+                               [](u8 x, u8) { return u32(u8(~x)); });
+}
+
+// out[i] is -1, 0 or 1 as a[i] is less, equal or greater than b[i]
+template <size_t bi_size>
+static void compare(const big_int_array<bi_size>& a,
+                    const big_int_array<bi_size>& b,
+                    i8* out) noexcept
+{
+    assert(a.size() == b.size());
+    const size_t count = a.size();
+
+    // the most significant limb is compared as signed by flipping the sign
+    // bits, the lower ones decide only while the higher ones are equal
+    const u8* a_top = a.limb(bi_size - 1);
+    const u8* b_top = b.limb(bi_size - 1);
+    for (size_t i = 0; i < count; ++i)
+    {
+        const u32 x = a_top[i] ^ 0x80U;
+        const u32 y = b_top[i] ^ 0x80U;
+        out[i] = i8(int(x > y) - int(x < y));
+    }
+
+    for (size_t k = bi_size - 2; k < bi_size; --k)
+    {
+        const u8* a_limb = a.limb(k);
+        const u8* b_limb = b.limb(k);
+        for (size_t i = 0; i < count; ++i)
+        {
+            const i8 limb_order =
+                i8(int(a_limb[i] > b_limb[i]) - int(a_limb[i] < b_limb[i]));
+            out[i] = out[i] != 0 ? out[i] : limb_order;
+        }
+    }
+}
+
+template <size_t bi_size>
+static void bit_and(const big_int_array<bi_size>& a,
+                    const big_int_array<bi_size>& b,
+                    big_int_array<bi_size>& out) noexcept
+{
+    detail::batch_bitwise_kernel(a, b, out,
+                                 [](u8 x, u8 y) { return u8(x & y); });
+}
+
+template <size_t bi_size>
+static void bit_or(const big_int_array<bi_size>& a,
+                   const big_int_array<bi_size>& b,
+                   big_int_array<bi_size>& out) noexcept
+{
+    detail::batch_bitwise_kernel(a, b, out,
+                                 [](u8 x, u8 y) { return u8(x | y); });
+}
+
+template <size_t bi_size>
+static void bit_xor(const big_int_array<bi_size>& a,
+                    const big_int_array<bi_size>& b,
+                    big_int_array<bi_size>& out) noexcept
+{
+    detail::batch_bitwise_kernel(a, b, out,
+                                 [](u8 x, u8 y) { return u8(x ^ y); });
+}
+
+template <size_t bi_size>
+static void bit_not(const big_int_array<bi_size>& a,
+                    big_int_array<bi_size>& out) noexcept
+{
+    detail::batch_bitwise_kernel(a, a, out, [](u8 x, u8) { return u8(~x); });
+}
+
+#endif  // ENABLE_BIG_INT_BATCH
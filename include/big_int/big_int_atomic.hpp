@@ -0,0 +1,308 @@
+#pragma once
+
+#ifdef ENABLE_SI_PARALLEL
+
+#include "big_int.hpp"
+#include "util.hpp"
+
+#include <atomic>
+#include <cstring>
+#include <memory>
+#include <thread>
+#include <type_traits>
+
+#if (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)
+// cmpxchg16b is missing only on the earliest x86-64 processors
+#define BIG_INT_HAS_CAS16
+#endif
+
+namespace detail
+{
+// Guards the value with a spinlock where no compare and swap is wide enough
+template <size_t size>
+class locked_cell
+{
+public:
+    static constexpr bool lock_free = false;
+
+    locked_cell() noexcept = default;
+
+    explicit locked_cell(const big_int<size>& init) noexcept : value(init) {}
+
+    BIG_INT_NODISCARD big_int<size> load() const noexcept
+    {
+        lock();
+        const big_int<size> res = value;
+        unlock();
+        return res;
+    }
+
+    bool compare_exchange(big_int<size>& expected,
+                          const big_int<size>& desired) noexcept
+    {
+        lock();
+        const bool equal = value == expected;
+        if (equal)
+        {
+            value = desired;
+        }
+        else
+        {
+            expected = value;
+        }
+        unlock();
+        return equal;
+    }
+
+    // Replaces the value by update(value) and returns the previous one
+    template <typename Update>
+    big_int<size> update(Update update_fn) noexcept
+    {
+        lock();
+        const big_int<size> previous = value;
+        value = update_fn(previous);
+        unlock();
+        return previous;
+    }
+
+private:
+    void lock() const noexcept
+    {
+        while (locked.exchange(true, std::memory_order_acquire))
+        {
+            while (locked.load(std::memory_order_relaxed))
+            {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    void unlock() const noexcept
+    {
+        locked.store(false, std::memory_order_release);
+    }
+
+    big_int<size> value;
+    mutable std::atomic<bool> locked{false};
+};
+
+#ifdef BIG_INT_HAS_CAS16
+// 16 bytes updated with the double-width compare and swap, lock cmpxchg16b
+// is a full barrier, so every operation is sequentially consistent
+class cas16_cell
+{
+public:
+    static constexpr bool lock_free = true;
+
+    cas16_cell() noexcept = default;
+
+    explicit cas16_cell(const big_int<16>& init) noexcept
+    {
+        std::memcpy(&words, init.raw.data(), sizeof(words));
+    }
+
+    BIG_INT_NODISCARD big_int<16> load() const noexcept
+    {
+        // there is no 16 byte atomic load, a failing exchange of zero with
+        // itself reads the value and a succeeding one leaves it as it was
+        words_t current = {0, 0};
+        cas(current, current);
+        return from_words(current);
+    }
+
+    bool compare_exchange(big_int<16>& expected,
+                          const big_int<16>& desired) noexcept
+    {
+        words_t expected_words = to_words(expected);
+        const bool equal = cas(expected_words, to_words(desired));
+        expected = from_words(expected_words);
+        return equal;
+    }
+
+    template <typename Update>
+    big_int<16> update(Update update_fn) noexcept
+    {
+        // the halves may be torn, then the first swap fails and brings the
+        // current value, which still saves a locked instruction usually
+        words_t current = {__atomic_load_n(&words.low, __ATOMIC_RELAXED),
+                           __atomic_load_n(&words.high, __ATOMIC_RELAXED)};
+        while (!cas(current, to_words(update_fn(from_words(current)))))
+        {
+        }
+        return from_words(current);
+    }
+
+private:
+    struct words_t
+    {
+        u64 low;
+        u64 high;
+    };
+
+    BIG_INT_NODISCARD static words_t to_words(const big_int<16>& value) noexcept
+    {
+        words_t res = {0, 0};
+        std::memcpy(&res, value.raw.data(), sizeof(res));
+        return res;
+    }
+
+    BIG_INT_NODISCARD static big_int<16> from_words(
+        const words_t& value) noexcept
+    {
+        big_int<16> res;
+        std::memcpy(res.raw.data(), &value, sizeof(value));
+        return res;
+    }
+
+    // The words are updated to the current value when the swap fails
+    bool cas(words_t& expected, const words_t& desired) const noexcept
+    {
+        bool equal = false;
+        __asm__ __volatile__("lock cmpxchg16b %1"
+                             : "=@ccz"(equal),
+                               "+m"(words),
+                               "+a"(expected.low),
+                               "+d"(expected.high)
+                             : "b"(desired.low), "c"(desired.high)
+                             : "memory");
+        return equal;
+    }
+
+    // written only through the inline assembly
+    alignas(16) mutable words_t words = {0, 0};
+};
+#endif  // BIG_INT_HAS_CAS16
+
+template <size_t size>
+struct atomic_cell
+{
+    using type = locked_cell<size>;
+};
+
+#ifdef BIG_INT_HAS_CAS16
+template <>
+struct atomic_cell<16>
+{
+    using type = cas16_cell;
+};
+#endif  // BIG_INT_HAS_CAS16
+}  // namespace detail
+
+// big_int shared between threads, the operations are sequentially consistent
+// Lock-free for big_int<16> on x86-64, the other sizes take a spinlock
+template <size_t size>
+class atomic_big_int
+{
+    using cell_t = typename detail::atomic_cell<size>::type;
+
+public:
+    static constexpr bool is_always_lock_free = cell_t::lock_free;
+
+    atomic_big_int() noexcept = default;
+
+    explicit atomic_big_int(const big_int<size>& init) noexcept : cell(init) {}
+
+    atomic_big_int(const atomic_big_int&) = delete;
+    atomic_big_int& operator=(const atomic_big_int&) = delete;
+
+    BIG_INT_NODISCARD big_int<size> load() const noexcept
+    {
+        return cell.load();
+    }
+
+    void store(const big_int<size>& desired) noexcept
+    {
+        static_cast<void>(exchange(desired));
+    }
+
+    big_int<size> exchange(const big_int<size>& desired) noexcept
+    {
+        return cell.update([&desired](const big_int<size>&)
+                           { return desired; });
+    }
+
+    // On failure expected is updated to the current value
+    bool compare_exchange_strong(big_int<size>& expected,
+                                 const big_int<size>& desired) noexcept
+    {
+        return cell.compare_exchange(expected, desired);
+    }
+
+    // Returns the previous value, the sum wraps like on big_int
+    big_int<size> fetch_add(const big_int<size>& other) noexcept
+    {
+        return cell.update([&other](const big_int<size>& current)
+                           { return current + other; });
+    }
+
+    big_int<size> fetch_sub(const big_int<size>& other) noexcept
+    {
+        return cell.update([&other](const big_int<size>& current)
+                           { return current - other; });
+    }
+
+private:
+    cell_t cell;
+};
+
+// Counter for many writers and rare readers
+// Every thread adds to its own cache line aligned shard, so the writers do
+// not contend for one cache line, load merges the shards
+// An add is a fetch_add on its shard, so without contention it costs as
+// much as one on atomic_big_int, the sharding only helps with many cores
+template <size_t size>
+class sharded_counter
+{
+public:
+    explicit sharded_counter(size_t shard_count = default_shard_count())
+        : count(shard_count == 0 ? 1 : shard_count),
+          shards(std::make_unique<shard[]>(count))
+    {
+    }
+
+    void add(const big_int<size>& value) noexcept
+    {
+        static_cast<void>(
+            shards[thread_slot() % count].value.fetch_add(value));
+    }
+
+    // Every add which finished before the call is counted, the ones running
+    // meanwhile may be counted or not
+    BIG_INT_NODISCARD big_int<size> load() const noexcept
+    {
+        big_int<size> res;
+        for (size_t i = 0; i < count; ++i)
+        {
+            res += shards[i].value.load();
+        }
+        return res;
+    }
+
+    BIG_INT_NODISCARD size_t shard_count() const noexcept { return count; }
+
+    BIG_INT_NODISCARD static size_t default_shard_count() noexcept
+    {
+        const size_t hardware = std::thread::hardware_concurrency();
+        return hardware == 0 ? 1 : hardware;
+    }
+
+private:
+    struct alignas(64) shard
+    {
+        atomic_big_int<size> value;
+    };
+
+    // The threads get consecutive slots, so they spread over the shards
+    static size_t thread_slot() noexcept
+    {
+        static std::atomic<size_t> next_slot{0};
+        thread_local const size_t slot =
+            next_slot.fetch_add(1, std::memory_order_relaxed);
+        return slot;
+    }
+
+    size_t count;
+    std::unique_ptr<shard[]> shards;
+};
+
+#endif  // ENABLE_SI_PARALLEL
@@ -0,0 +1,95 @@
+#pragma once
+
+#ifdef ENABLE_BIG_INT_BATCH
+
+#include "big_int.hpp"
+#include "util.hpp"
+
+#include <array>
+
+namespace detail
+{
+// Independent products computed side by side, so the multiplications of one
+// do not wait for the carries of another
+constexpr size_t multiply_lanes = 4;
+
+// The operands are regrouped to 32 bit limbs, every 32x32 -> 64 bit partial
+// product is split to halves that are summed per column (Comba's product
+// scanning), which keeps the accumulators in 64 bits without carry chains
+template <size_t bi_size>
+static void multiply_lanes_group(const big_int<bi_size>* a,
+                                 const big_int<bi_size>* b,
+                                 big_int<bi_size>* out) noexcept
+{
+    constexpr size_t limbs = (bi_size + 3) / 4;
+
+    std::array<std::array<u32, multiply_lanes>, limbs> x{};
+    std::array<std::array<u32, multiply_lanes>, limbs> y{};
+    for (size_t lane = 0; lane < multiply_lanes; ++lane)
+    {
+        for (size_t byte = 0; byte < bi_size; ++byte)
+        {
+            x[byte / 4][lane] |= u32(a[lane].raw[byte]) << (byte % 4 * 8);
+            y[byte / 4][lane] |= u32(b[lane].raw[byte]) << (byte % 4 * 8);
+        }
+    }
+
+    std::array<std::array<u32, multiply_lanes>, limbs> product{};
+    std::array<u64, multiply_lanes> carry{};
+
+    // only the columns below the size survive the truncation
+    for (size_t column = 0; column < limbs; ++column)
+    {
+        std::array<u64, multiply_lanes> low_sum{};
+        std::array<u64, multiply_lanes> high_sum{};
+
+        for (size_t i = 0; i <= column; ++i)
+        {
+            for (size_t lane = 0; lane < multiply_lanes; ++lane)
+            {
+                const u64 partial =
+                    u64(x[i][lane]) * u64(y[column - i][lane]);
+                low_sum[lane] += partial & 0xFFFFFFFFU;
+                high_sum[lane] += partial >> 32;
+            }
+        }
+
+        for (size_t lane = 0; lane < multiply_lanes; ++lane)
+        {
+            const u64 total = carry[lane] + low_sum[lane];
+            product[column][lane] = u32(total);
+            carry[lane] = (total >> 32) + high_sum[lane];
+        }
+    }
+
+    for (size_t lane = 0; lane < multiply_lanes; ++lane)
+    {
+        for (size_t byte = 0; byte < bi_size; ++byte)
+        {
+            out[lane].raw[byte] =
+                u8(product[byte / 4][lane] >> (byte % 4 * 8));
+        }
+    }
+}
+}  // namespace detail
+
+// out[i] = a[i] * b[i] for count unrelated products
+// out may alias a or b, the result is the same as with operator*
+template <size_t bi_size>
+static void multiply_many(const big_int<bi_size>* a,
+                          const big_int<bi_size>* b,
+                          big_int<bi_size>* out,
+                          size_t count) noexcept
+{
+    const size_t grouped = count - count % detail::multiply_lanes;
+    for (size_t i = 0; i < grouped; i += detail::multiply_lanes)
+    {
+        detail::multiply_lanes_group(a + i, b + i, out + i);
+    }
+    for (size_t i = grouped; i < count; ++i)
+    {
+        out[i] = a[i] * b[i];
+    }
+}
+
+#endif  // ENABLE_BIG_INT_BATCH
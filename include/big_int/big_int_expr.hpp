@@ -0,0 +1,213 @@
+#pragma once
+
+#ifdef ENABLE_BIG_INT_EXPR
+
+#include "big_int.hpp"
+#include "util.hpp"
+
+#include <tuple>
+#include <utility>
+
+// Opt-in lazy arithmetic, the operators of big_int stay eager
+// Sums of operands and products, e.g. a * b + c * d, a + b + c or a * b + c,
+// are only recorded, and then evaluated column by column in a single pass
+// that writes every byte of the destination once, with no temporary for the
+// products or the partial sums
+//     big_int<128> res = expr::lazy(a) * expr::lazy(b) + expr::lazy(c);
+// The expressions refer to their operands, so they have to be evaluated in
+// the statement that builds them
+namespace expr
+{
+template <size_t size>
+class operand
+{
+public:
+    constexpr explicit operand(const big_int<size>& init) noexcept
+        : ref(init)
+    {
+    }
+
+    BIG_INT_NODISCARD constexpr const big_int<size>& value() const noexcept
+    {
+        return ref;
+    }
+
+    BIG_INT_NODISCARD constexpr u64 column(size_t idx) const noexcept
+    {
+        return ref.raw[idx];
+    }
+
+    BIG_INT_NODISCARD constexpr bool refers_to(
+        const big_int<size>& dest) const noexcept
+    {
+        return &ref == &dest;
+    }
+
+private:
+    const big_int<size>& ref;
+};
+
+template <size_t size>
+class product
+{
+public:
+    constexpr product(const big_int<size>& init_a,
+                      const big_int<size>& init_b) noexcept
+        : a(init_a),
+          b(init_b),
+          a_len((init_a.bit_width() + 7) / 8),
+          b_len((init_b.bit_width() + 7) / 8)
+    {
+    }
+
+    BIG_INT_NODISCARD constexpr u64 column(size_t idx) const noexcept
+    {
+        return detail::product_column(a.raw, a_len, b.raw, b_len, idx);
+    }
+
+    BIG_INT_NODISCARD constexpr bool refers_to(
+        const big_int<size>& dest) const noexcept
+    {
+        return &a == &dest || &b == &dest;
+    }
+
+private:
+    const big_int<size>& a;
+    const big_int<size>& b;
+    size_t a_len;
+    size_t b_len;
+};
+
+// Wraps modulo 2^(8 * size) like the eager operators
+template <size_t size, typename... Terms>
+class sum
+{
+public:
+    constexpr explicit sum(std::tuple<Terms...> init) noexcept
+        : terms(std::move(init))
+    {
+    }
+
+    // Specifically not explicit so the expressions initialize big_ints
+    constexpr operator big_int<size>() const noexcept  // NOLINT
+    {
+        big_int<size> res;
+        evaluate_into(res);
+        return res;
+    }
+
+    BIG_INT_NODISCARD constexpr big_int<size> eval() const noexcept
+    {
+        return *this;
+    }
+
+    // The destination may be one of the operands, then the result is made
+    // aside first
+    constexpr void evaluate_into(big_int<size>& dest) const noexcept
+    {
+        if (refers_to(dest))
+        {
+            dest = eval();
+            return;
+        }
+
+        u64 carry = 0;
+        for (size_t i = 0; i < size; ++i)
+        {
+            carry += column(i);
+            dest.raw[i] = u8(carry);
+            carry >>= 8;
+        }
+    }
+
+    BIG_INT_NODISCARD constexpr const std::tuple<Terms...>& parts()
+        const noexcept
+    {
+        return terms;
+    }
+
+private:
+    BIG_INT_NODISCARD constexpr u64 column(size_t idx) const noexcept
+    {
+        return std::apply([idx](const Terms&... term)
+                          { return (term.column(idx) + ...); },
+                          terms);
+    }
+
+    BIG_INT_NODISCARD constexpr bool refers_to(
+        const big_int<size>& dest) const noexcept
+    {
+        return std::apply([&dest](const Terms&... term)
+                          { return (term.refers_to(dest) || ...); },
+                          terms);
+    }
+
+    std::tuple<Terms...> terms;
+};
+
+template <size_t size>
+BIG_INT_NODISCARD constexpr operand<size> lazy(
+    const big_int<size>& value) noexcept
+{
+    return operand<size>(value);
+}
+
+// The operand would not live until the evaluation
+template <size_t size>
+void lazy(const big_int<size>&& value) = delete;
+
+// Evaluates into an existing big_int, dest = expression would pick the
+// assignment from the integers
+template <size_t size, typename... Terms>
+constexpr void assign(big_int<size>& dest,
+                      const sum<size, Terms...>& expression) noexcept
+{
+    expression.evaluate_into(dest);
+}
+
+template <size_t size>
+BIG_INT_NODISCARD constexpr sum<size, product<size>> operator*(
+    const operand<size>& a,
+    const operand<size>& b) noexcept
+{
+    return sum<size, product<size>>(
+        std::make_tuple(product<size>(a.value(), b.value())));
+}
+
+template <size_t size>
+BIG_INT_NODISCARD constexpr sum<size, operand<size>, operand<size>> operator+(
+    const operand<size>& a,
+    const operand<size>& b) noexcept
+{
+    return sum<size, operand<size>, operand<size>>(std::make_tuple(a, b));
+}
+
+template <size_t size, typename... Terms>
+BIG_INT_NODISCARD constexpr sum<size, Terms..., operand<size>> operator+(
+    const sum<size, Terms...>& a,
+    const operand<size>& b) noexcept
+{
+    return sum<size, Terms..., operand<size>>(
+        std::tuple_cat(a.parts(), std::make_tuple(b)));
+}
+
+template <size_t size, typename... Terms>
+BIG_INT_NODISCARD constexpr sum<size, operand<size>, Terms...> operator+(
+    const operand<size>& a,
+    const sum<size, Terms...>& b) noexcept
+{
+    return sum<size, operand<size>, Terms...>(
+        std::tuple_cat(std::make_tuple(a), b.parts()));
+}
+
+template <size_t size, typename... Terms, typename... OtherTerms>
+BIG_INT_NODISCARD constexpr sum<size, Terms..., OtherTerms...> operator+(
+    const sum<size, Terms...>& a,
+    const sum<size, OtherTerms...>& b) noexcept
+{
+    return sum<size, Terms..., OtherTerms...>(
+        std::tuple_cat(a.parts(), b.parts()));
+}
+}  // namespace expr
+
+#endif  // ENABLE_BIG_INT_EXPR
@@ -0,0 +1,280 @@
+#pragma once
+
+#ifdef ENABLE_BIG_INT_UTIL
+
+#include "big_int.hpp"
+#include "big_int_util.hpp"
+#include "util.hpp"
+
+#include <array>
+#include <cassert>
+#include <stdexcept>
+
+// Modular arithmetic in Montgomery form
+// https://en.wikipedia.org/wiki/Montgomery_modular_multiplication
+// The limbs of big_int are bytes, so the reduction works modulo 2^8 per step
+// and R is 2^(8 * n), where n is the count of significant bytes of the modulus
+
+namespace detail
+{
+// -m^-1 mod 2^8 for an odd m
+// Newton's iteration doubles the correct bits: 3 -> 6 -> 12
+BIG_INT_NODISCARD constexpr static u8 montgomery_inverse(u8 m) noexcept
+{
+    u32 inverse = m;
+    inverse = (inverse * (2U - m * inverse)) & 0xFFU;
+    inverse = (inverse * (2U - m * inverse)) & 0xFFU;
+    return u8(0x100U - inverse);
+}
+}  // namespace detail
+
+// Context for a runtime modulus, the modulus has to be odd and positive
+// Values passed to multiply, add and subtract are expected in Montgomery form
+template <size_t size>
+class montgomery
+{
+public:
+    // Throws std::domain_error for a modulus that is not odd and positive,
+    // an even one has no inverse modulo 2^8
+    constexpr explicit montgomery(const big_int<size>& modulus)
+        : m(modulus),
+          m_inverse(detail::montgomery_inverse(modulus.raw[0])),
+          limbs((modulus.bit_width() + 7) / 8)
+    {
+        if (modulus.is_negative() || !modulus.test_bit(0))
+        {
+            throw std::domain_error("The modulus has to be odd and positive!");
+        }
+
+        using wide_t = big_int<size * 2>;
+        const wide_t wide_m = wide_t(m);
+
+        wide_t r;
+        r.set_bit(limbs * 8);
+        r %= wide_m;
+
+        r_mod_m = big_int<size>(r);
+        r_squared = big_int<size>((r * r) % wide_m);
+    }
+
+    BIG_INT_NODISCARD constexpr const big_int<size>& modulus() const noexcept
+    {
+        return m;
+    }
+
+    // The Montgomery form of one
+    BIG_INT_NODISCARD constexpr const big_int<size>& one() const noexcept
+    {
+        return r_mod_m;
+    }
+
+    BIG_INT_NODISCARD constexpr big_int<size> to_montgomery(
+        const big_int<size>& value) const
+    {
+        big_int<size> reduced = value % m;
+        if (reduced.is_negative())
+        {
+            reduced += m;
+        }
+        return multiply(reduced, r_squared);
+    }
+
+    BIG_INT_NODISCARD constexpr big_int<size> from_montgomery(
+        const big_int<size>& value) const noexcept
+    {
+        return multiply(value, big_int<size>::one());
+    }
+
+    // a * b * R^-1 mod m with the Coarsely Integrated Operand Scanning method
+    // Koc, Acar, Kaliski - Analyzing and comparing Montgomery multiplication
+    // algorithms, 1996
+    BIG_INT_NODISCARD constexpr big_int<size> multiply(
+        const big_int<size>& a,
+        const big_int<size>& b) const noexcept
+    {
+        std::array<u8, size + 2> t = {0};
+
+        for (size_t i = 0; i < limbs; ++i)
+        {
+            u32 carry = 0;
+            for (size_t j = 0; j < limbs; ++j)
+            {
+                const u32 sum = t[j] + u32(a.raw[j]) * b.raw[i] + carry;
+                t[j] = u8(sum);
+                carry = sum >> 8;
+            }
+            u32 sum = t[limbs] + carry;
+            t[limbs] = u8(sum);
+            t[limbs + 1] = u8(sum >> 8);
+
+            // adding the multiple of m clears the lowest byte
+            const u32 factor = u8(t[0] * u32(m_inverse));
+            carry = (t[0] + factor * m.raw[0]) >> 8;
+            for (size_t j = 1; j < limbs; ++j)
+            {
+                sum = t[j] + factor * m.raw[j] + carry;
+                t[j - 1] = u8(sum);
+                carry = sum >> 8;
+            }
+            sum = t[limbs] + carry;
+            t[limbs - 1] = u8(sum);
+            t[limbs] = u8(t[limbs + 1] + (sum >> 8));
+        }
+
+        // t < 2m, so at most one subtraction brings it in range
+        big_int<size> reduced;
+        u32 borrow = 0;
+        for (size_t j = 0; j < limbs; ++j)
+        {
+            const u32 subtrahend = m.raw[j] + borrow;
+            reduced.raw[j] = u8(t[j] - subtrahend);
+            borrow = t[j] < subtrahend ? 1U : 0U;
+        }
+
+        if (t[limbs] < borrow)
+        {
+            for (size_t j = 0; j < limbs; ++j)
+            {
+                reduced.raw[j] = t[j];
+            }
+        }
+        return reduced;
+    }
+
+    BIG_INT_NODISCARD constexpr big_int<size> add(
+        const big_int<size>& a,
+        const big_int<size>& b) const noexcept
+    {
+        // a - (m - b) stays in (-m, m) and cannot overflow
+        big_int<size> res = a - (m - b);
+        if (res.is_negative())
+        {
+            res += m;
+        }
+        return res;
+    }
+
+    BIG_INT_NODISCARD constexpr big_int<size> subtract(
+        const big_int<size>& a,
+        const big_int<size>& b) const noexcept
+    {
+        big_int<size> res = a - b;
+        if (res.is_negative())
+        {
+            res += m;
+        }
+        return res;
+    }
+
+    BIG_INT_NODISCARD constexpr big_int<size> pow(
+        const big_int<size>& base,
+        const big_int<size>& power) const noexcept
+    {
+        assert(!power.is_negative() && "Modular inverses are not supported!");
+        return detail::sliding_window_pow(
+            base, power, r_mod_m,
+            [this](const big_int<size>& a, const big_int<size>& b)
+            { return multiply(a, b); });
+    }
+
+private:
+    big_int<size> m;
+    u8 m_inverse;
+    size_t limbs;
+    big_int<size> r_mod_m;
+    big_int<size> r_squared;
+};
+
+// Integer modulo the compile time Modulus::value, kept in Montgomery form
+// Modulus is a type like
+// struct prime { static constexpr big_int<16> value = 1'000'000'007; };
+template <size_t size, typename Modulus>
+class mod_int
+{
+public:
+    static constexpr montgomery<size> context =
+        montgomery<size>(Modulus::value);
+
+    constexpr mod_int() noexcept = default;
+
+    // the context is made at compile time, so a bad modulus does not
+    // compile and to_montgomery cannot throw here
+    constexpr explicit mod_int(const big_int<size>& value) noexcept
+        : residue(context.to_montgomery(value))
+    {
+    }
+
+    // The canonical value in [0, Modulus::value)
+    BIG_INT_NODISCARD constexpr big_int<size> value() const noexcept
+    {
+        return context.from_montgomery(residue);
+    }
+
+    constexpr mod_int& operator+=(const mod_int& other) noexcept
+    {
+        residue = context.add(residue, other.residue);
+        return *this;
+    }
+
+    constexpr mod_int& operator-=(const mod_int& other) noexcept
+    {
+        residue = context.subtract(residue, other.residue);
+        return *this;
+    }
+
+    constexpr mod_int& operator*=(const mod_int& other) noexcept
+    {
+        residue = context.multiply(residue, other.residue);
+        return *this;
+    }
+
+    BIG_INT_NODISCARD constexpr mod_int operator+(
+        const mod_int& other) const noexcept
+    {
+        mod_int res = *this;
+        res += other;
+        return res;
+    }
+
+    BIG_INT_NODISCARD constexpr mod_int operator-(
+        const mod_int& other) const noexcept
+    {
+        mod_int res = *this;
+        res -= other;
+        return res;
+    }
+
+    BIG_INT_NODISCARD constexpr mod_int operator*(
+        const mod_int& other) const noexcept
+    {
+        mod_int res = *this;
+        res *= other;
+        return res;
+    }
+
+    // Equal residues mean equal values, no conversion is needed
+    BIG_INT_NODISCARD constexpr bool operator==(
+        const mod_int& other) const noexcept
+    {
+        return residue == other.residue;
+    }
+
+    BIG_INT_NODISCARD constexpr bool operator!=(
+        const mod_int& other) const noexcept
+    {
+        return !(*this == other);
+    }
+
+    BIG_INT_NODISCARD constexpr mod_int pow(
+        const big_int<size>& power) const noexcept
+    {
+        mod_int res;
+        res.residue = context.pow(residue, power);
+        return res;
+    }
+
+private:
+    big_int<size> residue;
+};
+
+#endif  // ENABLE_BIG_INT_UTIL
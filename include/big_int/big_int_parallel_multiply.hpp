@@ -0,0 +1,327 @@
+#pragma once
+
+#ifdef ENABLE_SI_PARALLEL
+
+#include "big_int.hpp"
+#include "si_executor.hpp"
+#include "util.hpp"
+
+#include <algorithm>
+#include <vector>
+
+// Multiplication of huge big_ints with Karatsuba's method, the independent
+// sub-products of the big enough levels run on an executor
+// The result is exactly operator*, so it does not depend on the scheduling
+namespace si::parallel
+{
+// Operands from this length in bytes split their sub-products over threads
+constexpr size_t default_parallel_multiply_bytes = 2048;
+
+namespace detail
+{
+// Up to this count of 32 bit limbs the schoolbook method is faster
+constexpr size_t karatsuba_limbs = 32;
+
+// res[0, a_len + b_len) += a * b, where res starts zeroed
+inline void schoolbook_multiply(const u32* a,
+                                size_t a_len,
+                                const u32* b,
+                                size_t b_len,
+                                u32* res) noexcept
+{
+    for (size_t i = 0; i < a_len; ++i)
+    {
+        u64 carry = 0;
+        for (size_t j = 0; j < b_len; ++j)
+        {
+            const u64 partial = u64(a[i]) * b[j] + res[i + j] + carry;
+            res[i + j] = u32(partial);
+            carry = partial >> 32;
+        }
+        res[i + b_len] = u32(carry);
+    }
+}
+
+// res[0, res_len) = the lowest res_len limbs of a * b, the partial
+// products at or above res_len are skipped
+inline void schoolbook_multiply_low(const u32* a,
+                                    size_t a_len,
+                                    const u32* b,
+                                    size_t b_len,
+                                    u32* res,
+                                    size_t res_len) noexcept
+{
+    std::fill(res, res + res_len, 0U);
+    for (size_t i = 0; i < a_len && i < res_len; ++i)
+    {
+        const size_t row_len = std::min(b_len, res_len - i);
+        u64 carry = 0;
+        for (size_t j = 0; j < row_len; ++j)
+        {
+            const u64 partial = u64(a[i]) * b[j] + res[i + j] + carry;
+            res[i + j] = u32(partial);
+            carry = partial >> 32;
+        }
+        if (i + row_len < res_len)
+        {
+            res[i + row_len] = u32(carry);
+        }
+    }
+}
+
+// dst[0, dst_len) += src[0, src_len), the carry out of dst is returned
+inline u32 add_limbs(u32* dst,
+                     size_t dst_len,
+                     const u32* src,
+                     size_t src_len) noexcept
+{
+    u64 carry = 0;
+    size_t i = 0;
+    for (; i < src_len; ++i)
+    {
+        const u64 sum = u64(dst[i]) + src[i] + carry;
+        dst[i] = u32(sum);
+        carry = sum >> 32;
+    }
+    for (; carry != 0 && i < dst_len; ++i)
+    {
+        const u64 sum = u64(dst[i]) + carry;
+        dst[i] = u32(sum);
+        carry = sum >> 32;
+    }
+    return u32(carry);
+}
+
+// dst[0, dst_len) -= src[0, src_len), dst has to stay non-negative
+inline void subtract_limbs(u32* dst,
+                           size_t dst_len,
+                           const u32* src,
+                           size_t src_len) noexcept
+{
+    u64 borrow = 0;
+    size_t i = 0;
+    for (; i < src_len; ++i)
+    {
+        const u64 subtrahend = u64(src[i]) + borrow;
+        borrow = dst[i] < subtrahend ? 1 : 0;
+        dst[i] = u32(dst[i] - subtrahend);
+    }
+    for (; borrow != 0 && i < dst_len; ++i)
+    {
+        borrow = dst[i] == 0 ? 1 : 0;
+        --dst[i];
+    }
+}
+
+// res[0, 2n) = a * b for operands of n limbs
+// a * b = z2 * B^2 + (z1 - z2 - z0) * B + z0, where B = 2^(32 * low),
+// z0 = a0 * b0, z2 = a1 * b1 and z1 = (a0 + a1) * (b0 + b1)
+inline void karatsuba_multiply(executor& exec,
+                               const u32* a,
+                               const u32* b,
+                               size_t n,
+                               u32* res,
+                               size_t parallel_limbs)
+{
+    if (n <= karatsuba_limbs)
+    {
+        std::fill(res, res + 2 * n, 0U);
+        schoolbook_multiply(a, n, b, n, res);
+        return;
+    }
+
+    const size_t low = n / 2;
+    const size_t high = n - low;
+
+    // the sums of the halves take one more limb
+    std::vector<u32> a_sum(a + low, a + n);
+    std::vector<u32> b_sum(b + low, b + n);
+    a_sum.push_back(add_limbs(a_sum.data(), high, a, low));
+    b_sum.push_back(add_limbs(b_sum.data(), high, b, low));
+    std::vector<u32> middle(2 * (high + 1));
+
+    // z0 and z2 go straight to their places in the result
+    const auto sub_product = [&](size_t which)
+    {
+        if (which == 0)
+        {
+            karatsuba_multiply(exec, a, b, low, res, parallel_limbs);
+        }
+        else if (which == 1)
+        {
+            karatsuba_multiply(exec, a + low, b + low, high, res + 2 * low,
+                               parallel_limbs);
+        }
+        else
+        {
+            karatsuba_multiply(exec, a_sum.data(), b_sum.data(), high + 1,
+                               middle.data(), parallel_limbs);
+        }
+    };
+
+    if (n >= parallel_limbs)
+    {
+        exec.run(3, sub_product);
+    }
+    else
+    {
+        for (size_t which = 0; which < 3; ++which)
+        {
+            sub_product(which);
+        }
+    }
+
+    subtract_limbs(middle.data(), middle.size(), res, 2 * low);
+    subtract_limbs(middle.data(), middle.size(), res + 2 * low, 2 * high);
+    add_limbs(res + low, 2 * n - low, middle.data(),
+              std::min(middle.size(), 2 * n - low));
+}
+
+// res[0, m) = the lowest m limbs of a * b for operands of n limbs, so the
+// limbs past the size of a wrapping big_int are not computed
+// a * b = a1 * b1 * B^2 + (a0 * b1 + a1 * b0) * B + a0 * b0, once m is at
+// most 2 * low a1 * b1 drops out and the cross products only need their
+// lowest m - low limbs, so they recurse as short products
+// a short product is about as costly as a full one of the same operands,
+// so when a1 * b1 is still needed the full product is made and truncated,
+// the four products of the split measured slower than the three of
+// karatsuba_multiply there
+inline void karatsuba_multiply_low(executor& exec,
+                                   const u32* a,
+                                   const u32* b,
+                                   size_t n,
+                                   u32* res,
+                                   size_t m,
+                                   size_t parallel_limbs)
+{
+    // only the lowest m limbs of a row are computed, so a short result is
+    // cheap for any n
+    if (n <= karatsuba_limbs || m <= karatsuba_limbs)
+    {
+        schoolbook_multiply_low(a, n, b, n, res, m);
+        return;
+    }
+
+    const size_t low = n / 2;
+    const size_t high = n - low;
+
+    if (m > 2 * low)
+    {
+        if (m >= 2 * n)
+        {
+            karatsuba_multiply(exec, a, b, n, res, parallel_limbs);
+            std::fill(res + 2 * n, res + m, 0U);
+            return;
+        }
+        std::vector<u32> full(2 * n);
+        karatsuba_multiply(exec, a, b, n, full.data(), parallel_limbs);
+        std::copy(full.begin(), full.begin() + std::ptrdiff_t(m), res);
+        return;
+    }
+
+    // the low halves are padded to the length of the high ones
+    std::vector<u32> a0(a, a + low);
+    std::vector<u32> b0(b, b + low);
+    a0.resize(high);
+    b0.resize(high);
+
+    const size_t cross_len = m - low;
+    std::vector<u32> cross_a(cross_len);
+    std::vector<u32> cross_b(cross_len);
+
+    const auto sub_product = [&](size_t which)
+    {
+        if (which == 0)
+        {
+            karatsuba_multiply_low(exec, a, b, low, res, m, parallel_limbs);
+        }
+        else if (which == 1)
+        {
+            karatsuba_multiply_low(exec, a0.data(), b + low, high,
+                                   cross_a.data(), cross_len, parallel_limbs);
+        }
+        else
+        {
+            karatsuba_multiply_low(exec, a + low, b0.data(), high,
+                                   cross_b.data(), cross_len, parallel_limbs);
+        }
+    };
+
+    if (n >= parallel_limbs)
+    {
+        exec.run(3, sub_product);
+    }
+    else
+    {
+        for (size_t which = 0; which < 3; ++which)
+        {
+            sub_product(which);
+        }
+    }
+
+    add_limbs(res + low, cross_len, cross_a.data(), cross_len);
+    add_limbs(res + low, cross_len, cross_b.data(), cross_len);
+}
+}  // namespace detail
+
+// The same as a * b, parallel_bytes is the operand length from which the
+// sub-products are computed on separate threads
+template <size_t size>
+BIG_INT_NODISCARD big_int<size> multiply(
+    executor& exec,
+    const big_int<size>& a,
+    const big_int<size>& b,
+    size_t parallel_bytes = default_parallel_multiply_bytes)
+{
+    const size_t a_len = (a.bit_width() + 31) / 32;
+    const size_t b_len = (b.bit_width() + 31) / 32;
+    const size_t n = std::max(a_len, b_len);
+
+    const auto to_limbs = [n](const big_int<size>& number)
+    {
+        std::vector<u32> limbs(n);
+        for (size_t i = 0; i < size && i / 4 < n; ++i)
+        {
+            limbs[i / 4] |= u32(number.raw[i]) << (i % 4 * 8);
+        }
+        return limbs;
+    };
+
+    const std::vector<u32> x = to_limbs(a);
+    const std::vector<u32> y = to_limbs(b);
+
+    // the product is truncated to the size like with operator*, so only
+    // the limbs below it are computed
+    const size_t product_len = std::min(2 * n, (size + 3) / 4);
+    std::vector<u32> product(product_len);
+
+    if (std::min(a_len, b_len) <= detail::karatsuba_limbs)
+    {
+        // a short operand gains nothing from the splitting
+        detail::schoolbook_multiply_low(x.data(), a_len, y.data(), b_len,
+                                        product.data(), product_len);
+    }
+    else
+    {
+        detail::karatsuba_multiply_low(
+            exec, x.data(), y.data(), n, product.data(), product_len,
+            std::max<size_t>(1, parallel_bytes / 4));
+    }
+
+    big_int<size> res;
+    for (size_t i = 0; i < size && i / 4 < product.size(); ++i)
+    {
+        res.raw[i] = u8(product[i / 4] >> (i % 4 * 8));
+    }
+    return res;
+}
+
+template <size_t size>
+BIG_INT_NODISCARD big_int<size> multiply(const big_int<size>& a,
+                                         const big_int<size>& b)
+{
+    return multiply(default_executor(), a, b);
+}
+}  // namespace si::parallel
+
+#endif  // ENABLE_SI_PARALLEL
@@ -0,0 +1,503 @@
+#pragma once
+
+#ifdef ENABLE_BIG_INT_BATCH
+
+#include "big_int.hpp"
+#include "big_int_array.hpp"
+#include "util.hpp"
+
+#include <cassert>
+
+#if (defined(__GNUC__) || defined(__clang__)) && \
+    (defined(__x86_64__) || defined(__i386__))
+#define BIG_INT_SIMD_X86
+#include <immintrin.h>
+#endif
+
+// Element-wise kernels over big_int_array with the instruction set picked at
+// runtime. Every vector lane holds one limb of a different element, so the
+// carries are generated with comparisons inside the lane and the elements
+// never depend on each other.
+
+namespace simd
+{
+enum class isa
+{
+    scalar,
+    avx2,
+    avx512
+};
+
+BIG_INT_NODISCARD inline isa detect_isa() noexcept
+{
+#ifdef BIG_INT_SIMD_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512bw"))
+    {
+        return isa::avx512;
+    }
+    if (__builtin_cpu_supports("avx2"))
+    {
+        return isa::avx2;
+    }
+#endif  // BIG_INT_SIMD_X86
+    return isa::scalar;
+}
+
+// Detected on the first call and cached for the rest of the program
+BIG_INT_NODISCARD inline isa active_isa() noexcept
+{
+    static const isa cached = detect_isa();
+    return cached;
+}
+}  // namespace simd
+
+namespace detail
+{
+// The kernels process the elements in [first, last)
+template <size_t bi_size>
+using batch_arithmetic_kernel = void (*)(const big_int_array<bi_size>&,
+                                         const big_int_array<bi_size>&,
+                                         big_int_array<bi_size>&,
+                                         size_t,
+                                         size_t);
+
+template <size_t bi_size>
+using batch_predicate_kernel = void (*)(const big_int_array<bi_size>&,
+                                        const big_int_array<bi_size>&,
+                                        u8*,
+                                        size_t,
+                                        size_t);
+
+#pragma region scalar_kernels
+template <size_t bi_size>
+static void scalar_add(const big_int_array<bi_size>& a,
+                       const big_int_array<bi_size>& b,
+                       big_int_array<bi_size>& out,
+                       size_t first,
+                       size_t last) noexcept
+{
+    for (size_t i = first; i < last; ++i)
+    {
+        big_int<bi_size> sum = a.get(i);
+        sum += b.get(i);
+        out.set(i, sum);
+    }
+}
+
+template <size_t bi_size>
+static void scalar_sub(const big_int_array<bi_size>& a,
+                       const big_int_array<bi_size>& b,
+                       big_int_array<bi_size>& out,
+                       size_t first,
+                       size_t last) noexcept
+{
+    for (size_t i = first; i < last; ++i)
+    {
+        big_int<bi_size> difference = a.get(i);
+        difference -= b.get(i);
+        out.set(i, difference);
+    }
+}
+
+template <size_t bi_size>
+static void scalar_equal(const big_int_array<bi_size>& a,
+                         const big_int_array<bi_size>& b,
+                         u8* out,
+                         size_t first,
+                         size_t last) noexcept
+{
+    for (size_t i = first; i < last; ++i)
+    {
+        out[i] = u8(a.get(i) == b.get(i));
+    }
+}
+
+template <size_t bi_size>
+static void scalar_less(const big_int_array<bi_size>& a,
+                        const big_int_array<bi_size>& b,
+                        u8* out,
+                        size_t first,
+                        size_t last) noexcept
+{
+    for (size_t i = first; i < last; ++i)
+    {
+        out[i] = u8(a.get(i) < b.get(i));
+    }
+}
+#pragma endregion
+
+#ifdef BIG_INT_SIMD_X86
+#pragma region avx2_kernels
+constexpr size_t avx2_lanes = 32;
+
+// The whole vectors in [first, last), the rest is left for the scalar kernel
+BIG_INT_NODISCARD constexpr static size_t vector_end(size_t first,
+                                                     size_t last,
+                                                     size_t lanes) noexcept
+{
+    return first + (last - first) / lanes * lanes;
+}
+
+// The masks hold 0xFF for a carry, so adding one is subtracting the mask
+// a + b + c overflows when the sum is below a, or equal to it with carry in
+template <size_t bi_size>
+__attribute__((target("avx2"))) static void avx2_add(
+    const big_int_array<bi_size>& a,
+    const big_int_array<bi_size>& b,
+    big_int_array<bi_size>& out,
+    size_t first,
+    size_t last) noexcept
+{
+    const size_t end = vector_end(first, last, avx2_lanes);
+    for (size_t i = first; i < end; i += avx2_lanes)
+    {
+        __m256i carry = _mm256_setzero_si256();
+        for (size_t k = 0; k < bi_size; ++k)
+        {
+            const __m256i x = _mm256_loadu_si256(
+                reinterpret_cast<const __m256i*>(a.limb(k) + i));
+            const __m256i y = _mm256_loadu_si256(
+                reinterpret_cast<const __m256i*>(b.limb(k) + i));
+            const __m256i sum =
+                _mm256_sub_epi8(_mm256_add_epi8(x, y), carry);
+
+            const __m256i not_below =
+                _mm256_cmpeq_epi8(_mm256_max_epu8(sum, x), sum);
+            const __m256i equal = _mm256_cmpeq_epi8(sum, x);
+            carry = _mm256_or_si256(_mm256_andnot_si256(not_below,
+                                                        _mm256_set1_epi8(-1)),
+                                    _mm256_and_si256(carry, equal));
+
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out.limb(k) + i),
+                                sum);
+        }
+    }
+    scalar_add(a, b, out, end, last);
+}
+
+// a - b - c borrows when a is below b, or equal to it with borrow in
+template <size_t bi_size>
+__attribute__((target("avx2"))) static void avx2_sub(
+    const big_int_array<bi_size>& a,
+    const big_int_array<bi_size>& b,
+    big_int_array<bi_size>& out,
+    size_t first,
+    size_t last) noexcept
+{
+    const size_t end = vector_end(first, last, avx2_lanes);
+    for (size_t i = first; i < end; i += avx2_lanes)
+    {
+        __m256i borrow = _mm256_setzero_si256();
+        for (size_t k = 0; k < bi_size; ++k)
+        {
+            const __m256i x = _mm256_loadu_si256(
+                reinterpret_cast<const __m256i*>(a.limb(k) + i));
+            const __m256i y = _mm256_loadu_si256(
+                reinterpret_cast<const __m256i*>(b.limb(k) + i));
+            const __m256i difference =
+                _mm256_add_epi8(_mm256_sub_epi8(x, y), borrow);
+
+            const __m256i not_below =
+                _mm256_cmpeq_epi8(_mm256_max_epu8(x, y), x);
+            const __m256i equal = _mm256_cmpeq_epi8(x, y);
+            borrow = _mm256_or_si256(_mm256_andnot_si256(not_below,
+                                                         _mm256_set1_epi8(-1)),
+                                     _mm256_and_si256(borrow, equal));
+
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out.limb(k) + i),
+                                difference);
+        }
+    }
+    scalar_sub(a, b, out, end, last);
+}
+
+template <size_t bi_size>
+__attribute__((target("avx2"))) static void avx2_equal(
+    const big_int_array<bi_size>& a,
+    const big_int_array<bi_size>& b,
+    u8* out,
+    size_t first,
+    size_t last) noexcept
+{
+    const size_t end = vector_end(first, last, avx2_lanes);
+    for (size_t i = first; i < end; i += avx2_lanes)
+    {
+        __m256i equal = _mm256_set1_epi8(-1);
+        for (size_t k = 0; k < bi_size; ++k)
+        {
+            const __m256i x = _mm256_loadu_si256(
+                reinterpret_cast<const __m256i*>(a.limb(k) + i));
+            const __m256i y = _mm256_loadu_si256(
+                reinterpret_cast<const __m256i*>(b.limb(k) + i));
+            equal = _mm256_and_si256(equal, _mm256_cmpeq_epi8(x, y));
+        }
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i),
+                            _mm256_and_si256(equal, _mm256_set1_epi8(1)));
+    }
+    scalar_equal(a, b, out, end, last);
+}
+
+// From the least significant limb up: less = below || (equal && less)
+// Only the most significant limb is compared as signed
+template <size_t bi_size>
+__attribute__((target("avx2"))) static void avx2_less(
+    const big_int_array<bi_size>& a,
+    const big_int_array<bi_size>& b,
+    u8* out,
+    size_t first,
+    size_t last) noexcept
+{
+    const __m256i sign = _mm256_set1_epi8(-128);
+    const size_t end = vector_end(first, last, avx2_lanes);
+    for (size_t i = first; i < end; i += avx2_lanes)
+    {
+        __m256i less = _mm256_setzero_si256();
+        for (size_t k = 0; k < bi_size; ++k)
+        {
+            __m256i x = _mm256_loadu_si256(
+                reinterpret_cast<const __m256i*>(a.limb(k) + i));
+            __m256i y = _mm256_loadu_si256(
+                reinterpret_cast<const __m256i*>(b.limb(k) + i));
+            const __m256i equal = _mm256_cmpeq_epi8(x, y);
+            if (k != bi_size - 1)
+            {
+                x = _mm256_xor_si256(x, sign);
+                y = _mm256_xor_si256(y, sign);
+            }
+            less = _mm256_or_si256(_mm256_cmpgt_epi8(y, x),
+                                   _mm256_and_si256(equal, less));
+        }
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i),
+                            _mm256_and_si256(less, _mm256_set1_epi8(1)));
+    }
+    scalar_less(a, b, out, end, last);
+}
+#pragma endregion
+
+#pragma region avx512_kernels
+constexpr size_t avx512_lanes = 64;
+
+// The carries live in the mask registers
+template <size_t bi_size>
+__attribute__((target("avx512f,avx512bw"))) static void avx512_add(
+    const big_int_array<bi_size>& a,
+    const big_int_array<bi_size>& b,
+    big_int_array<bi_size>& out,
+    size_t first,
+    size_t last) noexcept
+{
+    const __m512i one = _mm512_set1_epi8(1);
+    const size_t end = vector_end(first, last, avx512_lanes);
+    for (size_t i = first; i < end; i += avx512_lanes)
+    {
+        __mmask64 carry = 0;
+        for (size_t k = 0; k < bi_size; ++k)
+        {
+            const __m512i x = _mm512_loadu_si512(a.limb(k) + i);
+            const __m512i y = _mm512_loadu_si512(b.limb(k) + i);
+            __m512i sum = _mm512_add_epi8(x, y);
+            sum = _mm512_mask_add_epi8(sum, carry, sum, one);
+
+            carry = _kor_mask64(_mm512_cmplt_epu8_mask(sum, x),
+                                _kand_mask64(carry,
+                                             _mm512_cmpeq_epi8_mask(sum, x)));
+
+            _mm512_storeu_si512(out.limb(k) + i, sum);
+        }
+    }
+    scalar_add(a, b, out, end, last);
+}
+
+template <size_t bi_size>
+__attribute__((target("avx512f,avx512bw"))) static void avx512_sub(
+    const big_int_array<bi_size>& a,
+    const big_int_array<bi_size>& b,
+    big_int_array<bi_size>& out,
+    size_t first,
+    size_t last) noexcept
+{
+    const __m512i one = _mm512_set1_epi8(1);
+    const size_t end = vector_end(first, last, avx512_lanes);
+    for (size_t i = first; i < end; i += avx512_lanes)
+    {
+        __mmask64 borrow = 0;
+        for (size_t k = 0; k < bi_size; ++k)
+        {
+            const __m512i x = _mm512_loadu_si512(a.limb(k) + i);
+            const __m512i y = _mm512_loadu_si512(b.limb(k) + i);
+            __m512i difference = _mm512_sub_epi8(x, y);
+            difference = _mm512_mask_sub_epi8(difference, borrow, difference,
+                                              one);
+
+            borrow = _kor_mask64(_mm512_cmplt_epu8_mask(x, y),
+                                 _kand_mask64(borrow,
+                                              _mm512_cmpeq_epi8_mask(x, y)));
+
+            _mm512_storeu_si512(out.limb(k) + i, difference);
+        }
+    }
+    scalar_sub(a, b, out, end, last);
+}
+
+template <size_t bi_size>
+__attribute__((target("avx512f,avx512bw"))) static void avx512_equal(
+    const big_int_array<bi_size>& a,
+    const big_int_array<bi_size>& b,
+    u8* out,
+    size_t first,
+    size_t last) noexcept
+{
+    const __m512i one = _mm512_set1_epi8(1);
+    const size_t end = vector_end(first, last, avx512_lanes);
+    for (size_t i = first; i < end; i += avx512_lanes)
+    {
+        __mmask64 equal = ~__mmask64(0);
+        for (size_t k = 0; k < bi_size; ++k)
+        {
+            const __m512i x = _mm512_loadu_si512(a.limb(k) + i);
+            const __m512i y = _mm512_loadu_si512(b.limb(k) + i);
+            equal = _kand_mask64(equal, _mm512_cmpeq_epi8_mask(x, y));
+        }
+        _mm512_storeu_si512(out + i, _mm512_maskz_mov_epi8(equal, one));
+    }
+    scalar_equal(a, b, out, end, last);
+}
+
+template <size_t bi_size>
+__attribute__((target("avx512f,avx512bw"))) static void avx512_less(
+    const big_int_array<bi_size>& a,
+    const big_int_array<bi_size>& b,
+    u8* out,
+    size_t first,
+    size_t last) noexcept
+{
+    const __m512i one = _mm512_set1_epi8(1);
+    const size_t end = vector_end(first, last, avx512_lanes);
+    for (size_t i = first; i < end; i += avx512_lanes)
+    {
+        __mmask64 less = 0;
+        for (size_t k = 0; k < bi_size; ++k)
+        {
+            const __m512i x = _mm512_loadu_si512(a.limb(k) + i);
+            const __m512i y = _mm512_loadu_si512(b.limb(k) + i);
+            const __mmask64 below = k == bi_size - 1
+                                        ? _mm512_cmplt_epi8_mask(x, y)
+                                        : _mm512_cmplt_epu8_mask(x, y);
+            less = _kor_mask64(
+                below, _kand_mask64(less, _mm512_cmpeq_epi8_mask(x, y)));
+        }
+        _mm512_storeu_si512(out + i, _mm512_maskz_mov_epi8(less, one));
+    }
+    scalar_less(a, b, out, end, last);
+}
+#pragma endregion
+#endif  // BIG_INT_SIMD_X86
+
+template <typename kernel>
+BIG_INT_NODISCARD static kernel select_kernel(simd::isa level,
+                                              kernel scalar,
+                                              kernel avx2,
+                                              kernel avx512) noexcept
+{
+    switch (level)
+    {
+        case simd::isa::avx512:
+            return avx512;
+        case simd::isa::avx2:
+            return avx2;
+        case simd::isa::scalar:
+            break;
+    }
+    return scalar;
+}
+
+template <size_t bi_size>
+struct batch_kernels
+{
+    batch_arithmetic_kernel<bi_size> add;
+    batch_arithmetic_kernel<bi_size> sub;
+    batch_predicate_kernel<bi_size> equal;
+    batch_predicate_kernel<bi_size> less;
+};
+
+template <size_t bi_size>
+BIG_INT_NODISCARD static batch_kernels<bi_size> kernels_for(
+    simd::isa level) noexcept
+{
+#ifdef BIG_INT_SIMD_X86
+    return {
+        select_kernel<batch_arithmetic_kernel<bi_size>>(
+            level, scalar_add<bi_size>, avx2_add<bi_size>,
+            avx512_add<bi_size>),
+        select_kernel<batch_arithmetic_kernel<bi_size>>(
+            level, scalar_sub<bi_size>, avx2_sub<bi_size>,
+            avx512_sub<bi_size>),
+        select_kernel<batch_predicate_kernel<bi_size>>(
+            level, scalar_equal<bi_size>, avx2_equal<bi_size>,
+            avx512_equal<bi_size>),
+        select_kernel<batch_predicate_kernel<bi_size>>(
+            level, scalar_less<bi_size>, avx2_less<bi_size>,
+            avx512_less<bi_size>),
+    };
+#else
+    (void) level;
+    return {scalar_add<bi_size>, scalar_sub<bi_size>, scalar_equal<bi_size>,
+            scalar_less<bi_size>};
+#endif  // BIG_INT_SIMD_X86
+}
+
+// The function pointers are picked once per size
+template <size_t bi_size>
+BIG_INT_NODISCARD inline const batch_kernels<bi_size>& active_kernels() noexcept
+{
+    static const batch_kernels<bi_size> cached =
+        kernels_for<bi_size>(simd::active_isa());
+    return cached;
+}
+}  // namespace detail
+
+namespace simd
+{
+// out[i] = a[i] + b[i]
+template <size_t bi_size>
+void add(const big_int_array<bi_size>& a,
+         const big_int_array<bi_size>& b,
+         big_int_array<bi_size>& out) noexcept
+{
+    assert(a.size() == b.size() && a.size() == out.size());
+    detail::active_kernels<bi_size>().add(a, b, out, 0, a.size());
+}
+
+// out[i] = a[i] - b[i]
+template <size_t bi_size>
+void sub(const big_int_array<bi_size>& a,
+         const big_int_array<bi_size>& b,
+         big_int_array<bi_size>& out) noexcept
+{
+    assert(a.size() == b.size() && a.size() == out.size());
+    detail::active_kernels<bi_size>().sub(a, b, out, 0, a.size());
+}
+
+// out[i] = a[i] == b[i], one byte per element
+template <size_t bi_size>
+void equal(const big_int_array<bi_size>& a,
+           const big_int_array<bi_size>& b,
+           u8* out) noexcept
+{
+    assert(a.size() == b.size());
+    detail::active_kernels<bi_size>().equal(a, b, out, 0, a.size());
+}
+
+// out[i] = a[i] < b[i], one byte per element
+template <size_t bi_size>
+void less(const big_int_array<bi_size>& a,
+          const big_int_array<bi_size>& b,
+          u8* out) noexcept
+{
+    assert(a.size() == b.size());
+    detail::active_kernels<bi_size>().less(a, b, out, 0, a.size());
+}
+}  // namespace simd
+
+#endif  // ENABLE_BIG_INT_BATCH
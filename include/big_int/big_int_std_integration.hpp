@@ -15,9 +15,33 @@ struct std::common_type<big_int<sz_a>, big_int<sz_b>>
 
 #include <string>
 
+// Decimal digits with a leading minus for negative numbers
 template <size_t size>
-BIG_INT_NODISCARD static std::string to_string(
-    const big_int<size>& num) noexcept;
+BIG_INT_NODISCARD static std::string to_string(const big_int<size>& num)
+{
+    if (!num)
+    {
+        return "0";
+    }
+
+    // the division truncates towards zero, so negative numbers give
+    // negative remainders and the minimal value needs no negation
+    const big_int<size> ten = u8(10);
+    std::string res;
+    for (big_int<size> rest = num; rest;)
+    {
+        const big_int<size> quotient = rest / ten;
+        big_int<size> digit = rest - quotient * ten;
+        digit.abs();
+        res += char('0' + digit.raw[0]);
+        rest = quotient;
+    }
+    if (num.is_negative())
+    {
+        res += '-';
+    }
+    return std::string(res.rbegin(), res.rend());
+}
 
 template <size_t size>
 BIG_INT_NODISCARD static big_int<size> from_string(
@@ -0,0 +1,208 @@
+#pragma once
+
+#ifdef ENABLE_BIG_INT_UTIL
+
+#include "big_int.hpp"
+#include "util.hpp"
+
+#include <cmath>
+#include <cstring>
+
+// Exact sum of doubles in a fixed point big_int, as in
+// Kulisch - Computer Arithmetic and Validity, 2013
+// Every finite double is a multiple of 2^-1074 below 2^1024, so the sum is
+// kept exactly and does not depend on the order of the additions, partial
+// sums computed on different threads merge to the same bits
+class superaccumulator
+{
+public:
+    // The weight of the least significant bit is 2^-fraction_bits
+    static constexpr int fraction_bits = 1074;
+    // 1074 + 1024 bits hold any double, the remaining 78 bits are the sign
+    // and the room for the carries of 2^77 additions
+    static constexpr size_t bytes = 272;
+
+    using fixed_t = big_int<bytes>;
+
+    superaccumulator() noexcept = default;
+
+    explicit superaccumulator(double value) noexcept { add(value); }
+
+    void add(double value) noexcept
+    {
+        u64 bits = 0;
+        std::memcpy(&bits, &value, sizeof(bits));
+
+        const u32 biased_exponent = u32(bits >> 52) & 0x7FFU;
+        if (biased_exponent == 0x7FFU)
+        {
+            // infinities and NaNs follow the usual floating point rules
+            special = has_special ? special + value : value;
+            has_special = true;
+            return;
+        }
+
+        u64 mantissa = bits & ((u64(1) << 52) - 1);
+        if (biased_exponent != 0)
+        {
+            mantissa |= u64(1) << 52;
+        }
+
+        // subnormals have the same scale as the smallest normal exponent
+        const size_t position = biased_exponent == 0 ? 0 : biased_exponent - 1;
+        add_at(mantissa << (position % 8), position / 8, (bits >> 63) != 0);
+    }
+
+    superaccumulator& operator+=(double value) noexcept
+    {
+        add(value);
+        return *this;
+    }
+
+    // Merges a partial sum
+    superaccumulator& operator+=(const superaccumulator& other) noexcept
+    {
+        sum += other.sum;
+        if (other.has_special)
+        {
+            special = has_special ? special + other.special : other.special;
+            has_special = true;
+        }
+        return *this;
+    }
+
+    BIG_INT_NODISCARD superaccumulator operator+(
+        const superaccumulator& other) const noexcept
+    {
+        superaccumulator res = *this;
+        res += other;
+        return res;
+    }
+
+    // Equal sums hold exactly the same value
+    BIG_INT_NODISCARD bool operator==(
+        const superaccumulator& other) const noexcept
+    {
+        if (has_special || other.has_special)
+        {
+            return has_special == other.has_special && sum == other.sum &&
+                   std::memcmp(&special, &other.special, sizeof(special)) == 0;
+        }
+        return sum == other.sum;
+    }
+
+    BIG_INT_NODISCARD bool operator!=(
+        const superaccumulator& other) const noexcept
+    {
+        return !(*this == other);
+    }
+
+    BIG_INT_NODISCARD const fixed_t& fixed() const noexcept { return sum; }
+
+    // The exact sum rounded to the nearest double, ties to even
+    BIG_INT_NODISCARD double to_double() const noexcept
+    {
+        if (has_special)
+        {
+            return special;
+        }
+
+        const bool negative = sum.is_negative();
+        const fixed_t magnitude = negative ? -sum : sum;
+        const size_t width = magnitude.bit_width();
+        if (width == 0)
+        {
+            return 0.0;
+        }
+
+        const size_t top = width - 1;
+        double res = 0.0;
+        if (top < 53)
+        {
+            // at most 53 significant bits, so the conversion is exact
+            res = std::ldexp(double(bits_from(magnitude, 0)), -fraction_bits);
+        }
+        else
+        {
+            const size_t low = top >= 63 ? top - 63 : 0;
+            const u64 window = bits_from(magnitude, low);
+            const size_t shift = top - low - 52;
+
+            u64 mantissa = window >> shift;
+            const bool round = ((window >> (shift - 1)) & 1) != 0;
+            const bool sticky =
+                (window & ((u64(1) << (shift - 1)) - 1)) != 0 ||
+                any_bit_below(magnitude, low);
+            if (round && (sticky || (mantissa & 1) != 0))
+            {
+                // 2^53 is still exact and ldexp overflows to infinity
+                ++mantissa;
+            }
+            res = std::ldexp(double(mantissa),
+                             int(low + shift) - fraction_bits);
+        }
+        return negative ? -res : res;
+    }
+
+private:
+    // Adds or subtracts value * 2^(8 * first), the carries or borrows
+    // propagate only as far as they reach
+    void add_at(u64 value, size_t first, bool negative) noexcept
+    {
+        u64 carry = 0;
+        for (size_t i = first; i < bytes && (value != 0 || carry != 0); ++i)
+        {
+            if (negative)
+            {
+                const u64 subtrahend = (value & 0xFFU) + carry;
+                carry = sum.raw[i] < subtrahend ? 1 : 0;
+                sum.raw[i] = u8(sum.raw[i] - subtrahend);
+            }
+            else
+            {
+                const u64 total = sum.raw[i] + (value & 0xFFU) + carry;
+                sum.raw[i] = u8(total);
+                carry = total >> 8;
+            }
+            value >>= 8;
+        }
+    }
+
+    // The 64 bits starting at bit low
+    BIG_INT_NODISCARD static u64 bits_from(const fixed_t& number,
+                                           size_t low) noexcept
+    {
+        const size_t first = low / 8;
+        const size_t offset = low % 8;
+
+        u64 res = u64(number.raw[first]) >> offset;
+        for (size_t i = 1; i < 9 && first + i < bytes; ++i)
+        {
+            const size_t position = i * 8 - offset;
+            if (position < 64)
+            {
+                res |= u64(number.raw[first + i]) << position;
+            }
+        }
+        return res;
+    }
+
+    BIG_INT_NODISCARD static bool any_bit_below(const fixed_t& number,
+                                                size_t low) noexcept
+    {
+        for (size_t i = 0; i < low / 8; ++i)
+        {
+            if (number.raw[i] != 0)
+            {
+                return true;
+            }
+        }
+        return (number.raw[low / 8] & ((1U << (low % 8)) - 1)) != 0;
+    }
+
+    fixed_t sum;
+    double special = 0.0;
+    bool has_special = false;
+};
+
+#endif  // ENABLE_BIG_INT_UTIL
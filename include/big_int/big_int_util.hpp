@@ -5,15 +5,144 @@
 #include "big_int.hpp"
 #include "util.hpp"
 
+#include <array>
+#include <cassert>
+#include <stdexcept>
+
+namespace detail
+{
+template <size_t size>
+BIG_INT_NODISCARD constexpr static size_t countr_zero(
+    const big_int<size>& number) noexcept
+{
+    for (size_t i = 0; i < size; ++i)
+    {
+        if (number.raw[i] != 0)
+        {
+            size_t res = i * 8;
+            for (u8 byte = number.raw[i]; (byte & 1U) == 0;
+                 byte = u8(byte >> 1))
+            {
+                ++res;
+            }
+            return res;
+        }
+    }
+    return size * 8;
+}
+
+// Logical shifts of the bit pattern by any count of bits at once
+template <size_t size>
+constexpr static void shift_right_bits(big_int<size>& number,
+                                       size_t bits) noexcept
+{
+    const size_t bytes = bits / 8;
+    const u32 offset = u32(bits % 8);
+    for (size_t i = 0; i < size; ++i)
+    {
+        const u32 low = i + bytes < size ? number.raw[i + bytes] : 0U;
+        const u32 high = i + bytes + 1 < size ? number.raw[i + bytes + 1] : 0U;
+        number.raw[i] = u8((low | (high << 8)) >> offset);
+    }
+}
+
+template <size_t size>
+constexpr static void shift_left_bits(big_int<size>& number,
+                                      size_t bits) noexcept
+{
+    const size_t bytes = bits / 8;
+    const u32 offset = u32(bits % 8);
+    for (size_t i = size - 1; i < size; --i)
+    {
+        const u32 high = i >= bytes ? number.raw[i - bytes] : 0U;
+        const u32 low = i >= bytes + 1 ? number.raw[i - bytes - 1] : 0U;
+        number.raw[i] = u8(((high << 8) | low) >> (8 - offset));
+    }
+}
+}  // namespace detail
+
+// The greatest common divisor of the magnitudes, gcd(0, 0) is 0
+// Stein's binary algorithm, which only shifts and subtracts
 template <size_t size>
 BIG_INT_NODISCARD constexpr static big_int<size> gcd(
     const big_int<size>& a,
-    const big_int<size>& b) noexcept;
+    const big_int<size>& b) noexcept
+{
+    big_int<size> u = a.is_negative() ? -a : a;
+    big_int<size> v = b.is_negative() ? -b : b;
+    if (!u)
+    {
+        return v;
+    }
+    if (!v)
+    {
+        return u;
+    }
+
+    const size_t u_zeros = detail::countr_zero(u);
+    const size_t v_zeros = detail::countr_zero(v);
+    const size_t common_zeros = u_zeros < v_zeros ? u_zeros : v_zeros;
+    detail::shift_right_bits(u, u_zeros);
+    detail::shift_right_bits(v, v_zeros);
+
+    // both are odd, so their difference is even
+    while (true)
+    {
+        if (v < u)
+        {
+            const big_int<size> tmp = u;
+            u = v;
+            v = tmp;
+        }
+        v -= u;
+        if (!v)
+        {
+            break;
+        }
+        detail::shift_right_bits(v, detail::countr_zero(v));
+    }
 
+    detail::shift_left_bits(u, common_zeros);
+    return u;
+}
+
+// The least common multiple of the magnitudes, 0 if any of them is 0
 template <size_t size>
 BIG_INT_NODISCARD constexpr static big_int<size> lcm(
     const big_int<size>& a,
-    const big_int<size>& b) noexcept;
+    const big_int<size>& b) noexcept
+{
+    if (!a || !b)
+    {
+        return big_int<size>::zero();
+    }
+    const big_int<size> res = a / gcd(a, b) * b;
+    return res.is_negative() ? -res : res;
+}
+
+// a * b + c, wraps like the operators
+// The columns of the product are summed together with the bytes of c, so
+// the product is never stored on its own
+template <size_t size>
+BIG_INT_NODISCARD constexpr static big_int<size> fma(
+    const big_int<size>& a,
+    const big_int<size>& b,
+    const big_int<size>& c) noexcept
+{
+    const size_t a_len = (a.bit_width() + 7) / 8;
+    const size_t b_len = (b.bit_width() + 7) / 8;
+
+    big_int<size> res;
+    u64 carry = 0;
+    for (size_t i = 0; i < size; ++i)
+    {
+        carry += c.raw[i];
+        carry += detail::product_column(a.raw, a_len, b.raw, b_len, i);
+        res.raw[i] = u8(carry);
+        carry >>= 8;
+    }
+    return res;
+}
 
 template <size_t size>
 BIG_INT_NODISCARD constexpr static big_int<size> midpoint(
@@ -26,34 +155,446 @@ BIG_INT_NODISCARD constexpr static big_int<size> midpoint(
 }
 
 template <size_t size>
-BIG_INT_NODISCARD constexpr static big_int<size> log(
-    const big_int<size>& base,
+BIG_INT_NODISCARD constexpr static big_int<size> loglp(
     const big_int<size>& number) noexcept;
 
 template <size_t size>
-BIG_INT_NODISCARD constexpr static big_int<size> log2(
+BIG_INT_NODISCARD constexpr static big_int<size> exp(
     const big_int<size>& number) noexcept;
 
+namespace detail
+{
+// The value of a non-negative big_int, truncated to the width of size_t
 template <size_t size>
-BIG_INT_NODISCARD constexpr static big_int<size> log10(
-    const big_int<size>& number) noexcept;
+BIG_INT_NODISCARD constexpr static size_t to_size_t(
+    const big_int<size>& number) noexcept
+{
+    constexpr size_t bytes = size < sizeof(size_t) ? size : sizeof(size_t);
+    size_t res = 0;
+    for (size_t i = bytes - 1; i < bytes; --i)
+    {
+        res = (res << 8) | number.raw[i];
+    }
+    return res;
+}
 
 template <size_t size>
-BIG_INT_NODISCARD constexpr static big_int<size> loglp(
-    const big_int<size>& number) noexcept;
+BIG_INT_NODISCARD constexpr static big_int<size> from_size_t(
+    size_t number) noexcept
+{
+    return big_int<size>(big_int<sizeof(size_t)>(number));
+}
 
 template <size_t size>
-BIG_INT_NODISCARD constexpr static big_int<size> exp(
-    const big_int<size>& number) noexcept;
+BIG_INT_NODISCARD constexpr static big_int<size> max_value() noexcept
+{
+    big_int<size> max;
+    max.flip_sign_bit();
+    return ~max;
+}
 
+constexpr size_t max_pow_window_bits = 5;
+
+// Window sizes of the sliding window exponentiation, they minimize the count
+// of multiplications for the given exponent length (HAC, table 14.16)
+BIG_INT_NODISCARD constexpr static size_t pow_window_bits(
+    size_t exponent_bits) noexcept
+{
+    if (exponent_bits <= 8)
+    {
+        return 1;
+    }
+    if (exponent_bits <= 24)
+    {
+        return 2;
+    }
+    if (exponent_bits <= 80)
+    {
+        return 3;
+    }
+    if (exponent_bits <= 240)
+    {
+        return 4;
+    }
+    return max_pow_window_bits;
+}
+
+// Left-to-right sliding window exponentiation (HAC, algorithm 14.85)
+// Short exponents get a window of one bit, which is the plain
+// square-and-multiply, `multiply` is the ring multiplication to use
+template <typename T, size_t size, typename multiplication>
+BIG_INT_NODISCARD constexpr static T sliding_window_pow(
+    const T& base,
+    const big_int<size>& power,
+    const T& one,
+    multiplication multiply) noexcept
+{
+    const size_t bits = power.bit_width();
+    if (bits == 0)
+    {
+        return one;
+    }
+
+    const size_t window = pow_window_bits(bits);
+
+    // base^1, base^3, ..., base^(2^window - 1)
+    std::array<T, (size_t(1) << (max_pow_window_bits - 1))> odd_powers{};
+    odd_powers[0] = base;
+    if (window > 1)
+    {
+        const T base_squared = multiply(base, base);
+        for (size_t i = 1; i < (size_t(1) << (window - 1)); ++i)
+        {
+            odd_powers[i] = multiply(odd_powers[i - 1], base_squared);
+        }
+    }
+
+    T res = one;
+    bool is_one = true;
+
+    for (size_t i = bits - 1; i < bits;)
+    {
+        if (!power.test_bit(i))
+        {
+            if (!is_one)
+            {
+                res = multiply(res, res);
+            }
+            --i;
+            continue;
+        }
+
+        // the longest window ending in a set bit
+        size_t low = i + 1 >= window ? i + 1 - window : 0;
+        while (!power.test_bit(low))
+        {
+            ++low;
+        }
+
+        size_t window_value = 0;
+        for (size_t j = i; j >= low && j <= i; --j)
+        {
+            window_value = (window_value << 1) | size_t(power.test_bit(j));
+        }
+
+        if (is_one)
+        {
+            res = odd_powers[window_value / 2];
+            is_one = false;
+        }
+        else
+        {
+            for (size_t j = low; j <= i; ++j)
+            {
+                res = multiply(res, res);
+            }
+            res = multiply(res, odd_powers[window_value / 2]);
+        }
+
+        i = low - 1;
+    }
+
+    return res;
+}
+}  // namespace detail
+
+// 2 to the power of number, done by setting the single bit
+// Wraps like the other operations when the bit is outside of the integer
 template <size_t size>
 BIG_INT_NODISCARD constexpr static big_int<size> exp2(
-    const big_int<size>& number) noexcept;
+    const big_int<size>& number) noexcept
+{
+    constexpr size_t bits = size * 8;
+    big_int<size> res;
 
+    if (number.is_negative() || number.bit_width() > sizeof(size_t) * 8)
+    {
+        return res;
+    }
+
+    const size_t bit_idx = detail::to_size_t(number);
+    if (bit_idx < bits)
+    {
+        res.set_bit(bit_idx);
+    }
+    return res;
+}
+
+// Wraps on overflow, negative powers truncate towards zero
 template <size_t size>
 BIG_INT_NODISCARD constexpr static big_int<size> pow(
     const big_int<size>& base,
-    const big_int<size>& power) noexcept;
+    const big_int<size>& power) noexcept
+{
+    const big_int<size> one = big_int<size>::one();
+
+    if (power.is_negative())
+    {
+        // only +-1 have integer reciprocals
+        if (base == one)
+        {
+            return one;
+        }
+        if (base == -one)
+        {
+            return power.test_bit(0) ? base : one;
+        }
+        return big_int<size>::zero();
+    }
+
+    return detail::sliding_window_pow(
+        base, power, one,
+        [](const big_int<size>& a, const big_int<size>& b) { return a * b; });
+}
+
+// base to the power of power modulo mod, the result is in [0, mod)
+// The products are done in double width, so any positive mod can be used
+// Throws std::domain_error for a modulus that is not positive
+template <size_t size>
+BIG_INT_NODISCARD constexpr static big_int<size> pow_mod(
+    const big_int<size>& base,
+    const big_int<size>& power,
+    const big_int<size>& mod)
+{
+    assert(!power.is_negative() && "Modular inverses are not supported!");
+    if (!mod || mod.is_negative())
+    {
+        throw std::domain_error("The modulus has to be positive!");
+    }
+
+    using wide_t = big_int<size * 2>;
+    const wide_t wide_mod = wide_t(mod);
+
+    wide_t reduced_base = wide_t(base) % wide_mod;
+    if (reduced_base.is_negative())
+    {
+        reduced_base += wide_mod;
+    }
+
+    const wide_t res = detail::sliding_window_pow(
+        reduced_base, power, wide_t::one() % wide_mod,
+        [&wide_mod](const wide_t& a, const wide_t& b)
+        { return (a * b) % wide_mod; });
+
+    return big_int<size>(res);
+}
+
+// The largest integer whose k-th power does not exceed number
+// Negative numbers are allowed for odd k, the root truncates towards zero
+// Newton's iteration from a power of two above the root, it decreases
+// monotonically until it reaches the floor of the root
+template <size_t size>
+BIG_INT_NODISCARD constexpr static big_int<size> iroot(
+    const big_int<size>& number,
+    size_t k) noexcept
+{
+    assert(k > 0 && "There is no zeroth root!");
+    assert((!number.is_negative() || k % 2 == 1) &&
+           "Even roots of negative numbers are not integers!");
+
+    if (number.is_negative())
+    {
+        return -iroot(-number, k);
+    }
+
+    const size_t bits = number.bit_width();
+    if (k == 1 || bits <= 1)
+    {
+        return number;
+    }
+    if (k >= bits)
+    {
+        return big_int<size>::one();
+    }
+
+    // the intermediate powers of the estimate do not fit the original size
+    using wide_t = big_int<size * 2>;
+    const wide_t wide_number = wide_t(number);
+    const wide_t wide_k = detail::from_size_t<size * 2>(k);
+    const wide_t k_minus_one = wide_k - wide_t::one();
+
+    wide_t root;
+    root.set_bit((bits + k - 1) / k);
+
+    while (true)
+    {
+        const wide_t next =
+            (k_minus_one * root +
+             wide_number / pow(root, k_minus_one)) /
+            wide_k;
+        if (!(next < root))
+        {
+            return big_int<size>(root);
+        }
+        root = next;
+    }
+}
+
+// The largest integer whose square does not exceed number
+template <size_t size>
+BIG_INT_NODISCARD constexpr static big_int<size> isqrt(
+    const big_int<size>& number) noexcept
+{
+    assert(!number.is_negative() &&
+           "Square roots of negative numbers are not integers!");
+
+    const size_t bits = number.bit_width();
+    if (bits <= 1)
+    {
+        return number;
+    }
+
+    // 2^ceil(bits / 2) is above the root and the sum of the Newton step
+    // stays below 2^(bits / 2 + 2), so the original size is enough
+    const big_int<size> two = 2;
+    big_int<size> root;
+    root.set_bit((bits + 1) / 2);
+
+    while (true)
+    {
+        const big_int<size> next = (root + number / root) / two;
+        if (!(next < root))
+        {
+            return root;
+        }
+        root = next;
+    }
+}
+
+namespace detail
+{
+// Tables above this size take more space than the computation saves
+constexpr size_t max_powers_of_ten_table_size = 128;
+
+template <size_t size>
+BIG_INT_NODISCARD constexpr static size_t powers_of_ten_count() noexcept
+{
+    const big_int<size> limit = max_value<size>() / big_int<size>(u8(10));
+    big_int<size> power = 1;
+    size_t count = 1;
+    while (!(limit < power))
+    {
+        power *= big_int<size>(u8(10));
+        ++count;
+    }
+    return count;
+}
+
+// All the powers of ten that fit in big_int<size>
+template <size_t size>
+BIG_INT_NODISCARD constexpr static auto make_powers_of_ten() noexcept
+{
+    std::array<big_int<size>, powers_of_ten_count<size>()> table{};
+    table[0] = big_int<size>::one();
+    for (size_t i = 1; i < table.size(); ++i)
+    {
+        table[i] = big_int<size>(u8(10)) * table[i - 1];
+    }
+    return table;
+}
+
+template <size_t size>
+constexpr static auto powers_of_ten = make_powers_of_ten<size>();
+
+// 10^exponent, which has to fit in big_int<size>
+template <size_t size>
+BIG_INT_NODISCARD constexpr static big_int<size> power_of_ten(
+    size_t exponent) noexcept
+{
+    if constexpr (size <= max_powers_of_ten_table_size)
+    {
+        assert(exponent < powers_of_ten<size>.size());
+        return powers_of_ten<size>[exponent];
+    }
+    else
+    {
+        return pow(big_int<size>(u8(10)), from_size_t<size>(exponent));
+    }
+}
+
+// floor(bits * log10(2)) with log10(2) taken to 64 fractional bits
+BIG_INT_NODISCARD constexpr static size_t log10_of_exp2(size_t bits) noexcept
+{
+    constexpr u64 log10_2_high = 1292913986;
+    constexpr u64 log10_2_low = 2112355276;
+    const u64 wide_bits = bits;
+    return (wide_bits * log10_2_high + ((wide_bits * log10_2_low) >> 32)) >>
+           32;
+}
+}  // namespace detail
+
+// floor(log2(number)) from the position of the highest set bit
+// -1 for non-positive numbers
+template <size_t size>
+BIG_INT_NODISCARD constexpr static big_int<size> log2(
+    const big_int<size>& number) noexcept
+{
+    if (number.is_negative())
+    {
+        return -big_int<size>::one();
+    }
+    return detail::from_size_t<size>(number.bit_width()) -
+           big_int<size>::one();
+}
+
+// floor(log10(number)), -1 for non-positive numbers
+// The estimate from the bit width is corrected with the powers of ten
+template <size_t size>
+BIG_INT_NODISCARD constexpr static big_int<size> log10(
+    const big_int<size>& number) noexcept
+{
+    if (number.is_negative() || !number)
+    {
+        return -big_int<size>::one();
+    }
+
+    // number < 2^bit_width, so the estimate is at most one above the result
+    // and 10^estimate < 2^(size * 8 - 1) always fits
+    size_t estimate = detail::log10_of_exp2(number.bit_width());
+    if (number < detail::power_of_ten<size>(estimate))
+    {
+        --estimate;
+    }
+    return detail::from_size_t<size>(estimate);
+}
+
+// floor(log_base(number)), -1 for non-positive numbers or bases below 2
+// The powers base^(2^i) are found by repeated squaring and the result is
+// assembled from them bit by bit
+template <size_t size>
+BIG_INT_NODISCARD constexpr static big_int<size> log(
+    const big_int<size>& base,
+    const big_int<size>& number) noexcept
+{
+    const big_int<size> one = big_int<size>::one();
+    if (number.is_negative() || !number || base.is_negative() || base <= one)
+    {
+        return -one;
+    }
+
+    // base^(2^i) <= number < 2^(size * 8), so there is one per bit of i
+    std::array<big_int<size>, sizeof(size_t) * 8> squares{};
+    size_t count = 0;
+    squares[count++] = base;
+    while (count < squares.size() &&
+           squares[count - 1] <= number / squares[count - 1])
+    {
+        squares[count] = squares[count - 1] * squares[count - 1];
+        ++count;
+    }
+
+    big_int<size> accumulated = one;
+    size_t res = 0;
+    for (size_t i = count - 1; i < count; --i)
+    {
+        if (accumulated <= number / squares[i])
+        {
+            accumulated *= squares[i];
+            res |= size_t(1) << i;
+        }
+    }
+    return detail::from_size_t<size>(res);
+}
 
 template <size_t size>
 BIG_INT_NODISCARD constexpr static big_int<size> expml(
@@ -104,12 +645,179 @@ BIG_INT_NODISCARD static constexpr const big_int<size>& clamp(
     }
 }
 
+namespace detail
+{
+constexpr size_t max_factorial_table_size = 128;
+constexpr size_t max_fibonacci_table_size = 32;
+
 template <size_t size>
-BIG_INT_NODISCARD static constexpr const big_int<size>& fact(
-    const big_int<size>& num) noexcept;
+BIG_INT_NODISCARD constexpr static size_t factorial_count() noexcept
+{
+    const big_int<size> max = max_value<size>();
+    big_int<size> factorial = 1;
+    size_t count = 1;
+    while (!(max / from_size_t<size>(count) < factorial))
+    {
+        factorial *= from_size_t<size>(count);
+        ++count;
+    }
+    return count;
+}
 
+// 0!, 1!, ... up to the last one that fits in big_int<size>
 template <size_t size>
-BIG_INT_NODISCARD static constexpr const big_int<size>& fib(
-    const big_int<size>& num) noexcept;
+BIG_INT_NODISCARD constexpr static auto make_factorials() noexcept
+{
+    std::array<big_int<size>, factorial_count<size>()> table{};
+    table[0] = big_int<size>::one();
+    for (size_t i = 1; i < table.size(); ++i)
+    {
+        table[i] = table[i - 1] * from_size_t<size>(i);
+    }
+    return table;
+}
+
+template <size_t size>
+constexpr static auto factorials = make_factorials<size>();
+
+template <size_t size>
+BIG_INT_NODISCARD constexpr static size_t fibonacci_count() noexcept
+{
+    const big_int<size> max = max_value<size>();
+    big_int<size> previous = 0;
+    big_int<size> current = 1;
+    size_t count = 2;
+    while (!(max - previous < current))
+    {
+        const big_int<size> next = previous + current;
+        previous = current;
+        current = next;
+        ++count;
+    }
+    return count;
+}
+
+// F(0), F(1), ... up to the last one that fits in big_int<size>
+template <size_t size>
+BIG_INT_NODISCARD constexpr static auto make_fibonacci() noexcept
+{
+    std::array<big_int<size>, fibonacci_count<size>()> table{};
+    table[1] = big_int<size>::one();
+    for (size_t i = 2; i < table.size(); ++i)
+    {
+        table[i] = table[i - 1] + table[i - 2];
+    }
+    return table;
+}
+
+template <size_t size>
+constexpr static auto fibonacci = make_fibonacci<size>();
+
+// The product of [low, high] by binary splitting, so the multiplications
+// are between operands of similar length instead of big by small
+template <size_t size>
+BIG_INT_NODISCARD constexpr static big_int<size> range_product(
+    size_t low,
+    size_t high) noexcept
+{
+    constexpr size_t sequential_range = 8;
+    if (high - low < sequential_range)
+    {
+        big_int<size> res = from_size_t<size>(low);
+        for (size_t i = low + 1; i <= high; ++i)
+        {
+            res *= from_size_t<size>(i);
+        }
+        return res;
+    }
+
+    const size_t mid = low + (high - low) / 2;
+    return range_product<size>(low, mid) * range_product<size>(mid + 1, high);
+}
+}  // namespace detail
+
+// num!, wraps on overflow
+template <size_t size>
+BIG_INT_NODISCARD static constexpr big_int<size> fact(
+    const big_int<size>& num) noexcept
+{
+    assert(!num.is_negative() && "There is no factorial of negative numbers!");
+
+    // n! has n - popcount(n) factors of two, so past this point it is a
+    // multiple of 2^(size * 8) and wraps to zero
+    constexpr size_t zero_from = size * 8 + sizeof(size_t) * 8 + 1;
+    if (num.is_negative() || num.bit_width() >= sizeof(size_t) * 8 ||
+        detail::to_size_t(num) >= zero_from)
+    {
+        return big_int<size>::zero();
+    }
+
+    const size_t n = detail::to_size_t(num);
+    if constexpr (size <= detail::max_factorial_table_size)
+    {
+        constexpr auto& table = detail::factorials<size>;
+        if (n < table.size())
+        {
+            return table[n];
+        }
+        return table.back() * detail::range_product<size>(table.size(), n);
+    }
+    else
+    {
+        return n < 2 ? big_int<size>::one() : detail::range_product<size>(2, n);
+    }
+}
+
+// The num-th Fibonacci number, wraps on overflow
+// Fast doubling: F(2k) = F(k)(2F(k + 1) - F(k)), F(2k + 1) = F(k)^2 +
+// F(k + 1)^2 and negative indices follow F(-n) = (-1)^(n + 1) F(n)
+template <size_t size>
+BIG_INT_NODISCARD static constexpr big_int<size> fib(
+    const big_int<size>& num) noexcept
+{
+    const big_int<size> n = num.is_negative() ? -num : num;
+    const bool should_negate = num.is_negative() && !n.test_bit(0);
+
+    big_int<size> res;
+    bool found = false;
+    if constexpr (size <= detail::max_fibonacci_table_size)
+    {
+        constexpr auto& table = detail::fibonacci<size>;
+        if (n.bit_width() < sizeof(size_t) * 8 &&
+            detail::to_size_t(n) < table.size())
+        {
+            res = table[detail::to_size_t(n)];
+            found = true;
+        }
+    }
+
+    if (!found)
+    {
+        big_int<size> current = 0;
+        big_int<size> next = 1;
+        for (size_t i = n.bit_width() - 1; i < size * 8; --i)
+        {
+            const big_int<size> doubled = current * (next + next - current);
+            const big_int<size> doubled_next = current * current + next * next;
+            if (n.test_bit(i))
+            {
+                current = doubled_next;
+                next = doubled + doubled_next;
+            }
+            else
+            {
+                current = doubled;
+                next = doubled_next;
+            }
+        }
+        res = current;
+    }
+
+    if (should_negate)
+    {
+        res.negate();
+    }
+    return res;
+}
 
 #endif  // ENABLE_BIG_INT_UTIL
@@ -0,0 +1,308 @@
+#pragma once
+
+#ifdef ENABLE_BIG_INT_UTIL
+
+#include "big_int.hpp"
+#include "big_int_util.hpp"
+#include "util.hpp"
+
+#include <stdexcept>
+#include <type_traits>
+
+#ifdef ENABLE_BIG_INT_STD_INTEGRATION
+#include "big_int_std_integration.hpp"
+
+#include <ostream>
+#include <string>
+#endif  // ENABLE_BIG_INT_STD_INTEGRATION
+
+// Exact fraction of two big_int<size>, the denominator is kept positive
+// The common factors are not removed after every operation, only by
+// normalize() or when the fraction grows past half of the bits, so the
+// products of the next operation still fit, values which are too big even
+// when reduced wrap like big_int.
+// Chains of multiplications and divisions mostly skip the gcd.
+// The const members never reduce in place, numerator(), denominator() and
+// printing reduce a copy, and the comparisons cross-multiply in double width
+// without reducing at all, so const fractions can be shared between threads.
+template <size_t size>
+class big_rational
+{
+public:
+    using int_t = big_int<size>;
+
+    // Operands with more significant bits than this are reduced first
+    static constexpr size_t headroom_bits = size * 4 - 1;
+
+    constexpr big_rational() noexcept = default;
+
+    // Specifically not explicit so it can be used like the integers
+    constexpr big_rational(const int_t& init) noexcept  // NOLINT
+        : num(init)
+    {
+    }
+
+    template <
+        typename T,
+        typename = typename std::enable_if<std::is_integral<T>::value>::type>
+    constexpr big_rational(T init) noexcept  // NOLINT
+        : num(init)
+    {
+    }
+
+    constexpr big_rational(const int_t& init_num, const int_t& init_den)
+        : num(init_num), den(init_den), reduced(false)
+    {
+        if (!den)
+        {
+            throw std::domain_error("Zero denominator!");
+        }
+        if (den.is_negative())
+        {
+            num.negate();
+            den.negate();
+        }
+    }
+
+    // The reduced numerator, negative for negative fractions
+    BIG_INT_NODISCARD constexpr int_t numerator() const noexcept
+    {
+        return normalized().num;
+    }
+
+    // The reduced denominator, always positive
+    BIG_INT_NODISCARD constexpr int_t denominator() const noexcept
+    {
+        return normalized().den;
+    }
+
+    // The same value in lowest terms
+    BIG_INT_NODISCARD constexpr big_rational normalized() const noexcept
+    {
+        big_rational res = *this;
+        res.normalize();
+        return res;
+    }
+
+    // Removes the common factors, the value does not change
+    constexpr void normalize() noexcept
+    {
+        if (reduced)
+        {
+            return;
+        }
+        const int_t divisor = gcd(num, den);
+        if (divisor != int_t::one())
+        {
+            num /= divisor;
+            den /= divisor;
+        }
+        reduced = true;
+    }
+
+    BIG_INT_NODISCARD constexpr bool is_normalized() const noexcept
+    {
+        return reduced;
+    }
+
+    constexpr big_rational& operator+=(const big_rational& other) noexcept
+    {
+        const big_rational addend = make_room(other);
+        if (den == addend.den)
+        {
+            num += addend.num;
+        }
+        else
+        {
+            num = num * addend.den + addend.num * den;
+            den *= addend.den;
+        }
+        reduced = !num;
+        if (reduced)
+        {
+            den = int_t::one();
+        }
+        return *this;
+    }
+
+    constexpr big_rational& operator-=(const big_rational& other) noexcept
+    {
+        return *this += -other;
+    }
+
+    constexpr big_rational& operator*=(const big_rational& other) noexcept
+    {
+        const big_rational factor = make_room(other);
+        num *= factor.num;
+        den *= factor.den;
+        reduced = false;
+        return *this;
+    }
+
+    // Throws std::domain_error for a zero divisor
+    constexpr big_rational& operator/=(const big_rational& other)
+    {
+        if (!other.num)
+        {
+            throw std::domain_error("Division by zero!");
+        }
+        const big_rational divisor = make_room(other);
+        const bool negative = divisor.num.is_negative();
+        num *= negative ? -divisor.den : divisor.den;
+        den *= negative ? -divisor.num : divisor.num;
+        reduced = false;
+        return *this;
+    }
+
+    BIG_INT_NODISCARD constexpr big_rational operator-() const noexcept
+    {
+        big_rational res = *this;
+        res.num.negate();
+        return res;
+    }
+
+    BIG_INT_NODISCARD constexpr big_rational operator+(
+        const big_rational& other) const noexcept
+    {
+        big_rational res = *this;
+        res += other;
+        return res;
+    }
+
+    BIG_INT_NODISCARD constexpr big_rational operator-(
+        const big_rational& other) const noexcept
+    {
+        big_rational res = *this;
+        res -= other;
+        return res;
+    }
+
+    BIG_INT_NODISCARD constexpr big_rational operator*(
+        const big_rational& other) const noexcept
+    {
+        big_rational res = *this;
+        res *= other;
+        return res;
+    }
+
+    BIG_INT_NODISCARD constexpr big_rational operator/(
+        const big_rational& other) const
+    {
+        big_rational res = *this;
+        res /= other;
+        return res;
+    }
+
+    BIG_INT_NODISCARD constexpr bool operator==(
+        const big_rational& other) const noexcept
+    {
+        if (den == other.den)
+        {
+            return num == other.num;
+        }
+        return cross(num, other.den) == cross(other.num, den);
+    }
+
+    BIG_INT_NODISCARD constexpr bool operator!=(
+        const big_rational& other) const noexcept
+    {
+        return !(*this == other);
+    }
+
+    BIG_INT_NODISCARD constexpr bool operator<(
+        const big_rational& other) const noexcept
+    {
+        if (den == other.den)
+        {
+            return num < other.num;
+        }
+        return cross(num, other.den) < cross(other.num, den);
+    }
+
+    BIG_INT_NODISCARD constexpr bool operator<=(
+        const big_rational& other) const noexcept
+    {
+        return !(other < *this);
+    }
+
+    BIG_INT_NODISCARD constexpr bool operator>(
+        const big_rational& other) const noexcept
+    {
+        return other < *this;
+    }
+
+    BIG_INT_NODISCARD constexpr bool operator>=(
+        const big_rational& other) const noexcept
+    {
+        return !(*this < other);
+    }
+
+    // Truncates towards zero like the integer division
+    BIG_INT_NODISCARD constexpr int_t truncate() const noexcept
+    {
+        return num / den;
+    }
+
+private:
+    using wide_t = big_int<size * 2>;
+
+    // The products of the comparisons are exact in double width
+    BIG_INT_NODISCARD constexpr static wide_t cross(const int_t& a,
+                                                    const int_t& b) noexcept
+    {
+        return wide_t(a) * wide_t(b);
+    }
+
+    BIG_INT_NODISCARD constexpr static size_t magnitude_width(
+        const int_t& number) noexcept
+    {
+        return number.is_negative() ? (-number).bit_width()
+                                    : number.bit_width();
+    }
+
+    BIG_INT_NODISCARD constexpr bool exceeds_headroom() const noexcept
+    {
+        return magnitude_width(num) > headroom_bits ||
+               den.bit_width() > headroom_bits;
+    }
+
+    // Reduces the operands which could overflow the products, the other
+    // operand is reduced in the returned copy, which also keeps it apart
+    // when it is this fraction
+    BIG_INT_NODISCARD constexpr big_rational make_room(
+        const big_rational& other) noexcept
+    {
+        if (exceeds_headroom())
+        {
+            normalize();
+        }
+        return other.exceeds_headroom() ? other.normalized() : other;
+    }
+
+    int_t num;
+    int_t den = int_t::one();
+    bool reduced = true;
+};
+
+#ifdef ENABLE_BIG_INT_STD_INTEGRATION
+// numerator/denominator in lowest terms, just the numerator for integers
+template <size_t size>
+BIG_INT_NODISCARD static std::string to_string(const big_rational<size>& a)
+{
+    const big_rational<size> reduced = a.normalized();
+    if (reduced.denominator() == big_int<size>::one())
+    {
+        return to_string(reduced.numerator());
+    }
+    return to_string(reduced.numerator()) + '/' +
+           to_string(reduced.denominator());
+}
+
+template <size_t size>
+static std::ostream& operator<<(std::ostream& os, const big_rational<size>& a)
+{
+    return os << to_string(a);
+}
+#endif  // ENABLE_BIG_INT_STD_INTEGRATION
+
+#endif  // ENABLE_BIG_INT_UTIL
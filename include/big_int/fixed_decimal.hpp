@@ -0,0 +1,239 @@
+#pragma once
+
+#ifdef ENABLE_BIG_INT_UTIL
+
+#include "big_int.hpp"
+#include "big_int_util.hpp"
+#include "util.hpp"
+
+#include <type_traits>
+
+#ifdef ENABLE_BIG_INT_STD_INTEGRATION
+#include "big_int_std_integration.hpp"
+
+#include <ostream>
+#include <string>
+#endif  // ENABLE_BIG_INT_STD_INTEGRATION
+
+// Decimal fixed point number, the value is units * 10^-scale, so e.g.
+// millijoules are fixed_decimal<size, 3> of joules and stay exact
+// Operands of the same scale add as plain big_ints and the products only add
+// the scales, only the rescaling to fewer digits divides
+template <size_t size, size_t scale>
+class fixed_decimal
+{
+public:
+    using int_t = big_int<size>;
+
+    constexpr fixed_decimal() noexcept = default;
+
+    // A whole number
+    template <
+        typename T,
+        typename = typename std::enable_if<std::is_integral<T>::value>::type>
+    constexpr explicit fixed_decimal(T init) noexcept
+        : value(int_t(init) * detail::power_of_ten<size>(scale))
+    {
+    }
+
+    // units of 10^-scale, e.g. from_units(1500) is 1.5 with a scale of 3
+    BIG_INT_NODISCARD constexpr static fixed_decimal from_units(
+        const int_t& units) noexcept
+    {
+        fixed_decimal res;
+        res.value = units;
+        return res;
+    }
+
+    BIG_INT_NODISCARD constexpr const int_t& units() const noexcept
+    {
+        return value;
+    }
+
+    // The integer part, truncated towards zero
+    BIG_INT_NODISCARD constexpr int_t whole() const noexcept
+    {
+        return rescale<0>().units();
+    }
+
+    // The same value with another count of decimal digits, going to fewer
+    // digits truncates towards zero
+    // More digits multiply by a power of ten from the table, fewer digits
+    // divide by native powers of ten of up to 10^16, which take the short
+    // division by a single limb, and the truncations of the steps compose
+    template <size_t new_scale>
+    BIG_INT_NODISCARD constexpr fixed_decimal<size, new_scale> rescale()
+        const noexcept
+    {
+        if constexpr (new_scale >= scale)
+        {
+            return fixed_decimal<size, new_scale>::from_units(
+                value * detail::power_of_ten<size>(new_scale - scale));
+        }
+        else
+        {
+            int_t res = value;
+            size_t digits = scale - new_scale;
+            for (; digits > max_step_digits; digits -= max_step_digits)
+            {
+                res /= native_power_of_ten(max_step_digits);
+            }
+            res /= native_power_of_ten(digits);
+            return fixed_decimal<size, new_scale>::from_units(res);
+        }
+    }
+
+    constexpr fixed_decimal& operator+=(const fixed_decimal& other) noexcept
+    {
+        value += other.value;
+        return *this;
+    }
+
+    constexpr fixed_decimal& operator-=(const fixed_decimal& other) noexcept
+    {
+        value -= other.value;
+        return *this;
+    }
+
+    BIG_INT_NODISCARD constexpr fixed_decimal operator+(
+        const fixed_decimal& other) const noexcept
+    {
+        return from_units(value + other.value);
+    }
+
+    BIG_INT_NODISCARD constexpr fixed_decimal operator-(
+        const fixed_decimal& other) const noexcept
+    {
+        return from_units(value - other.value);
+    }
+
+    BIG_INT_NODISCARD constexpr fixed_decimal operator-() const noexcept
+    {
+        return from_units(-value);
+    }
+
+    // The scales add up, so the product is exact without any division
+    template <size_t other_scale>
+    BIG_INT_NODISCARD constexpr fixed_decimal<size, scale + other_scale>
+    operator*(const fixed_decimal<size, other_scale>& other) const noexcept
+    {
+        return fixed_decimal<size, scale + other_scale>::from_units(
+            value * other.units());
+    }
+
+    // By a dimensionless integer, the scale stays
+    constexpr fixed_decimal& operator*=(const int_t& factor) noexcept
+    {
+        value *= factor;
+        return *this;
+    }
+
+    // Truncates towards zero, throws std::domain_error for a zero divisor
+    constexpr fixed_decimal& operator/=(const int_t& divisor)
+    {
+        value /= divisor;
+        return *this;
+    }
+
+    // By built-in integers, without converting them to a big_int
+    template <typename T, typename = detail::if_limb_t<T>>
+    constexpr fixed_decimal& operator*=(T factor) noexcept
+    {
+        value *= factor;
+        return *this;
+    }
+
+    template <typename T, typename = detail::if_limb_t<T>>
+    constexpr fixed_decimal& operator/=(T divisor)
+    {
+        value /= divisor;
+        return *this;
+    }
+
+    BIG_INT_NODISCARD constexpr bool operator==(
+        const fixed_decimal& other) const noexcept
+    {
+        return value == other.value;
+    }
+
+    BIG_INT_NODISCARD constexpr bool operator!=(
+        const fixed_decimal& other) const noexcept
+    {
+        return value != other.value;
+    }
+
+    BIG_INT_NODISCARD constexpr bool operator<(
+        const fixed_decimal& other) const noexcept
+    {
+        return value < other.value;
+    }
+
+    BIG_INT_NODISCARD constexpr bool operator<=(
+        const fixed_decimal& other) const noexcept
+    {
+        return value <= other.value;
+    }
+
+    BIG_INT_NODISCARD constexpr bool operator>(
+        const fixed_decimal& other) const noexcept
+    {
+        return value > other.value;
+    }
+
+    BIG_INT_NODISCARD constexpr bool operator>=(
+        const fixed_decimal& other) const noexcept
+    {
+        return value >= other.value;
+    }
+
+private:
+    // 10^16 is the largest power of ten below 2^56, the larger divisors
+    // leave the short division
+    static constexpr size_t max_step_digits = 16;
+
+    BIG_INT_NODISCARD constexpr static u64 native_power_of_ten(
+        size_t digits) noexcept
+    {
+        u64 res = 1;
+        for (size_t i = 0; i < digits; ++i)
+        {
+            res *= 10;
+        }
+        return res;
+    }
+
+    int_t value;
+};
+
+#ifdef ENABLE_BIG_INT_STD_INTEGRATION
+// All of the scale digits, e.g. "-1.500" for -1500 units with a scale of 3
+template <size_t size, size_t scale>
+BIG_INT_NODISCARD static std::string to_string(
+    const fixed_decimal<size, scale>& number)
+{
+    const bool negative = number.units().is_negative();
+    std::string digits = to_string(number.units());
+    if (negative)
+    {
+        digits.erase(0, 1);
+    }
+    if (digits.size() <= scale)
+    {
+        digits.insert(0, scale + 1 - digits.size(), '0');
+    }
+    if constexpr (scale != 0)
+    {
+        digits.insert(digits.size() - scale, 1, '.');
+    }
+    return negative ? '-' + digits : digits;
+}
+
+template <size_t size, size_t scale>
+static std::ostream& operator<<(std::ostream& os,
+                                const fixed_decimal<size, scale>& number)
+{
+    return os << to_string(number);
+}
+#endif  // ENABLE_BIG_INT_STD_INTEGRATION
+
+#endif  // ENABLE_BIG_INT_UTIL
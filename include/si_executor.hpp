@@ -0,0 +1,613 @@
+#pragma once
+
+#ifdef ENABLE_SI_PARALLEL
+
+#include "util.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace si::parallel
+{
+// Where the parallel algorithms run their work
+// Derive from it to run them on the threads of an existing scheduler and
+// pass it to the algorithms or install it with set_default_executor
+class executor
+{
+public:
+    executor() = default;
+    executor(const executor&) = delete;
+    executor& operator=(const executor&) = delete;
+    virtual ~executor() = default;
+
+    // The count of threads working at once, the calling thread included
+    BIG_INT_NODISCARD virtual size_t concurrency() const noexcept = 0;
+
+    // Calls body(begin, end) for disjoint ranges covering [0, count), which
+    // are not split below grain indices, and returns once all are done
+    // The first exception thrown by the body is rethrown here
+    virtual void bulk_execute(
+        size_t count,
+        size_t grain,
+        const std::function<void(size_t, size_t)>& body) = 0;
+
+    // Calls task(i) for every i in [0, count)
+    template <typename Task>
+    void run(size_t count, Task&& task)
+    {
+        bulk_execute(count, 1,
+                     [&task](size_t begin, size_t end)
+                     {
+                         for (size_t i = begin; i < end; ++i)
+                         {
+                             task(i);
+                         }
+                     });
+    }
+};
+
+// Runs everything on the calling thread
+class inline_executor final : public executor
+{
+public:
+    BIG_INT_NODISCARD size_t concurrency() const noexcept override
+    {
+        return 1;
+    }
+
+    void bulk_execute(
+        size_t count,
+        size_t,
+        const std::function<void(size_t, size_t)>& body) override
+    {
+        if (count != 0)
+        {
+            body(0, count);
+        }
+    }
+};
+
+namespace detail
+{
+constexpr size_t cache_line = 64;
+
+// Chase, Lev - Dynamic circular work-stealing deque, 2005
+// with the memory orders from Le, Pop, Cohen, Zappa Nardelli - Correct and
+// efficient work-stealing for weak memory models, 2013
+// Only the owner pushes and pops at the bottom, any thread steals from the
+// top without locking, nullptr stands for an empty deque or a lost race
+template <typename T>
+class work_stealing_deque
+{
+    static_assert(std::is_pointer<T>::value,
+                  "The items are kept in atomics, they have to be pointers!");
+
+public:
+    explicit work_stealing_deque(size_t capacity = 64)
+    {
+        assert((capacity & (capacity - 1)) == 0 &&
+               "The capacity has to be a power of two!");
+        rings.push_back(std::make_unique<ring>(capacity));
+        array.store(rings.back().get(), std::memory_order_relaxed);
+    }
+
+    void push(T item)
+    {
+        const i64 b = bottom.load(std::memory_order_relaxed);
+        const i64 t = top.load(std::memory_order_acquire);
+        ring* a = array.load(std::memory_order_relaxed);
+        if (b - t > i64(a->capacity) - 1)
+        {
+            a = grow(a, t, b);
+        }
+        a->put(b, item);
+        bottom.store(b + 1, std::memory_order_release);
+    }
+
+    BIG_INT_NODISCARD T pop()
+    {
+        const i64 b = bottom.load(std::memory_order_relaxed) - 1;
+        ring* a = array.load(std::memory_order_relaxed);
+        bottom.store(b, std::memory_order_seq_cst);
+        i64 t = top.load(std::memory_order_seq_cst);
+
+        if (t > b)
+        {
+            bottom.store(b + 1, std::memory_order_relaxed);
+            return nullptr;
+        }
+
+        T item = a->get(b);
+        if (t == b)
+        {
+            // the last item, the thieves race for it too
+            if (!top.compare_exchange_strong(t, t + 1,
+                                             std::memory_order_seq_cst,
+                                             std::memory_order_relaxed))
+            {
+                item = nullptr;
+            }
+            bottom.store(b + 1, std::memory_order_relaxed);
+        }
+        return item;
+    }
+
+    BIG_INT_NODISCARD T steal()
+    {
+        i64 t = top.load(std::memory_order_seq_cst);
+        const i64 b = bottom.load(std::memory_order_seq_cst);
+        if (t >= b)
+        {
+            return nullptr;
+        }
+
+        const ring* a = array.load(std::memory_order_acquire);
+        T item = a->get(t);
+        if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                         std::memory_order_relaxed))
+        {
+            return nullptr;
+        }
+        return item;
+    }
+
+    // Only a hint while other threads push or steal
+    BIG_INT_NODISCARD bool empty() const noexcept
+    {
+        return top.load(std::memory_order_seq_cst) >=
+               bottom.load(std::memory_order_seq_cst);
+    }
+
+private:
+    struct ring
+    {
+        explicit ring(size_t size)
+            : capacity(size), items(new std::atomic<T>[size]())
+        {
+        }
+
+        BIG_INT_NODISCARD T get(i64 idx) const noexcept
+        {
+            return items[size_t(idx) & (capacity - 1)].load(
+                std::memory_order_relaxed);
+        }
+
+        void put(i64 idx, T item) noexcept
+        {
+            items[size_t(idx) & (capacity - 1)].store(
+                item, std::memory_order_relaxed);
+        }
+
+        const size_t capacity;
+        std::unique_ptr<std::atomic<T>[]> items;
+    };
+
+    // The old rings are kept, a thief may still be reading from them
+    ring* grow(const ring* old, i64 t, i64 b)
+    {
+        rings.push_back(std::make_unique<ring>(old->capacity * 2));
+        ring* bigger = rings.back().get();
+        for (i64 i = t; i < b; ++i)
+        {
+            bigger->put(i, old->get(i));
+        }
+        array.store(bigger, std::memory_order_release);
+        return bigger;
+    }
+
+    alignas(cache_line) std::atomic<i64> top{0};
+    alignas(cache_line) std::atomic<i64> bottom{0};
+    std::atomic<ring*> array{nullptr};
+    std::vector<std::unique_ptr<ring>> rings;
+};
+}  // namespace detail
+
+// Work-stealing pool
+// A range is a single task at first, whoever runs it keeps the lower half
+// and pushes the upper one to its deque until the range is down to the
+// grain, so the idle threads steal the biggest pieces left
+// Threads waiting for their work to finish, including the calling thread and
+// the workers running nested parallel loops, execute the tasks meanwhile
+class thread_pool final : public executor
+{
+public:
+    explicit thread_pool(size_t thread_count = default_thread_count())
+        : worker_count(thread_count > 1 ? thread_count - 1 : 0),
+          workers(std::make_unique<worker_state[]>(worker_count))
+    {
+        for (size_t i = 0; i < worker_count; ++i)
+        {
+            workers[i].pool = this;
+            workers[i].random = 2 * i + 1;
+            workers[i].thread = std::thread([this, i] { work(workers[i]); });
+        }
+    }
+
+    ~thread_pool() override
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping.store(true, std::memory_order_release);
+        }
+        wake.notify_all();
+        for (size_t i = 0; i < worker_count; ++i)
+        {
+            workers[i].thread.join();
+        }
+    }
+
+    BIG_INT_NODISCARD size_t concurrency() const noexcept override
+    {
+        return worker_count + 1;
+    }
+
+    void bulk_execute(
+        size_t count,
+        size_t grain,
+        const std::function<void(size_t, size_t)>& body) override
+    {
+        // a coarser grain bounds the count of the tasks of a job
+        const size_t max_tasks = concurrency() * max_tasks_per_thread;
+        grain = std::max({grain, size_t(1),
+                          (count + max_tasks - 1) / max_tasks});
+        if (count == 0)
+        {
+            return;
+        }
+        if (worker_count == 0 || count <= grain)
+        {
+            body(0, count);
+            return;
+        }
+
+        job current(body, count, grain);
+        spawn(current.make_task(0, count));
+        help_until_done(current);
+
+        if (current.error)
+        {
+            std::rethrow_exception(current.error);
+        }
+    }
+
+    BIG_INT_NODISCARD static size_t default_thread_count() noexcept
+    {
+        const size_t hardware = std::thread::hardware_concurrency();
+        return hardware == 0 ? 1 : hardware;
+    }
+
+private:
+    struct job;
+
+    struct task
+    {
+        job* owner;
+        size_t begin;
+        size_t end;
+    };
+
+    struct job
+    {
+        job(const std::function<void(size_t, size_t)>& job_body,
+            size_t count,
+            size_t job_grain)
+            : body(job_body),
+              grain(job_grain),
+              // every split leaves at least half of the grain on both sides
+              tasks(2 * ((count + job_grain - 1) / job_grain) + 1),
+              remaining(count)
+        {
+        }
+
+        task* make_task(size_t begin, size_t end) noexcept
+        {
+            const size_t idx =
+                allocated.fetch_add(1, std::memory_order_relaxed);
+            assert(idx < tasks.size());
+            tasks[idx] = task{this, begin, end};
+            return &tasks[idx];
+        }
+
+        const std::function<void(size_t, size_t)>& body;
+        const size_t grain;
+        std::vector<task> tasks;
+        std::atomic<size_t> allocated{0};
+        std::atomic<size_t> remaining;
+
+        std::mutex mutex;
+        std::condition_variable finished;
+        bool done = false;
+        std::exception_ptr error;
+    };
+
+    struct alignas(detail::cache_line) worker_state
+    {
+        detail::work_stealing_deque<task*> deque;
+        thread_pool* pool = nullptr;
+        u64 random = 1;
+        std::thread thread;
+    };
+
+    // Rounds without work before a worker goes to sleep
+    static constexpr size_t spin_rounds = 64;
+    static constexpr size_t max_tasks_per_thread = 256;
+
+    static worker_state*& current_worker() noexcept
+    {
+        thread_local worker_state* worker = nullptr;
+        return worker;
+    }
+
+    static u64& external_random() noexcept
+    {
+        thread_local u64 random =
+            std::hash<std::thread::id>()(std::this_thread::get_id()) | 1;
+        return random;
+    }
+
+    BIG_INT_NODISCARD worker_state* own_worker() const noexcept
+    {
+        worker_state* worker = current_worker();
+        return worker != nullptr && worker->pool == this ? worker : nullptr;
+    }
+
+    void spawn(task* spawned)
+    {
+        if (worker_state* self = own_worker())
+        {
+            self->deque.push(spawned);
+        }
+        else
+        {
+            std::lock_guard<std::mutex> lock(injected_mutex);
+            injected.push_back(spawned);
+            injected_count.fetch_add(1, std::memory_order_release);
+        }
+
+        // the read-modify-write orders this against a worker announcing its
+        // sleep, so either the worker sees the task or this sees the worker
+        if (sleepers.fetch_add(0, std::memory_order_seq_cst) != 0)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            wake.notify_one();
+        }
+    }
+
+    void execute(task& current)
+    {
+        job& owner = *current.owner;
+        const size_t begin = current.begin;
+        size_t end = current.end;
+
+        while (end - begin > owner.grain)
+        {
+            const size_t middle = begin + (end - begin) / 2;
+            spawn(owner.make_task(middle, end));
+            end = middle;
+        }
+
+        try
+        {
+            owner.body(begin, end);
+        }
+        catch (...)
+        {
+            std::lock_guard<std::mutex> lock(owner.mutex);
+            if (!owner.error)
+            {
+                owner.error = std::current_exception();
+            }
+        }
+
+        if (owner.remaining.fetch_sub(end - begin,
+                                      std::memory_order_acq_rel) ==
+            end - begin)
+        {
+            // the job may be gone once the lock is released
+            std::lock_guard<std::mutex> lock(owner.mutex);
+            owner.done = true;
+            owner.finished.notify_all();
+        }
+    }
+
+    BIG_INT_NODISCARD task* find_task(worker_state* self)
+    {
+        if (self != nullptr)
+        {
+            if (task* own = self->deque.pop())
+            {
+                return own;
+            }
+        }
+
+        if (injected_count.load(std::memory_order_acquire) != 0)
+        {
+            std::lock_guard<std::mutex> lock(injected_mutex);
+            if (!injected.empty())
+            {
+                task* oldest = injected.front();
+                injected.pop_front();
+                injected_count.fetch_sub(1, std::memory_order_relaxed);
+                return oldest;
+            }
+        }
+
+        // the victims are tried from a random one, so the thieves spread
+        u64& random = self != nullptr ? self->random : external_random();
+        random ^= random << 13;
+        random ^= random >> 7;
+        random ^= random << 17;
+
+        for (size_t i = 0; i < worker_count; ++i)
+        {
+            worker_state& victim = workers[(random + i) % worker_count];
+            if (&victim == self)
+            {
+                continue;
+            }
+            if (task* stolen = victim.deque.steal())
+            {
+                return stolen;
+            }
+        }
+        return nullptr;
+    }
+
+    BIG_INT_NODISCARD bool has_work() const noexcept
+    {
+        if (injected_count.load(std::memory_order_acquire) != 0)
+        {
+            return true;
+        }
+        for (size_t i = 0; i < worker_count; ++i)
+        {
+            if (!workers[i].deque.empty())
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void help_until_done(job& current)
+    {
+        worker_state* self = own_worker();
+        while (current.remaining.load(std::memory_order_acquire) != 0)
+        {
+            if (task* found = find_task(self))
+            {
+                execute(*found);
+                continue;
+            }
+
+            // the rest is running elsewhere, new splits may still show up
+            std::unique_lock<std::mutex> lock(current.mutex);
+            current.finished.wait_for(lock, std::chrono::microseconds(100),
+                                      [&current] { return current.done; });
+        }
+
+        std::unique_lock<std::mutex> lock(current.mutex);
+        current.finished.wait(lock, [&current] { return current.done; });
+    }
+
+    void work(worker_state& self)
+    {
+        current_worker() = &self;
+
+        size_t idle_rounds = 0;
+        while (!stopping.load(std::memory_order_acquire))
+        {
+            if (task* found = find_task(&self))
+            {
+                execute(*found);
+                idle_rounds = 0;
+                continue;
+            }
+
+            if (++idle_rounds < spin_rounds)
+            {
+                std::this_thread::yield();
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock(mutex);
+            sleepers.fetch_add(1, std::memory_order_seq_cst);
+            wake.wait(lock,
+                      [this]
+                      {
+                          return stopping.load(std::memory_order_acquire) ||
+                                 has_work();
+                      });
+            sleepers.fetch_sub(1, std::memory_order_relaxed);
+            idle_rounds = 0;
+        }
+    }
+
+    const size_t worker_count;
+    std::unique_ptr<worker_state[]> workers;
+
+    // tasks spawned by threads outside of the pool
+    std::mutex injected_mutex;
+    std::deque<task*> injected;
+    std::atomic<size_t> injected_count{0};
+
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::atomic<size_t> sleepers{0};
+    std::atomic<bool> stopping{false};
+};
+
+namespace detail
+{
+inline std::atomic<executor*>& installed_executor() noexcept
+{
+    static std::atomic<executor*> installed{nullptr};
+    return installed;
+}
+}  // namespace detail
+
+// Started on the first use
+inline thread_pool& default_pool()
+{
+    static thread_pool pool;
+    return pool;
+}
+
+// The executor of the overloads without an explicit one, nullptr brings back
+// the default pool, the executor has to outlive its use
+inline void set_default_executor(executor* installed) noexcept
+{
+    detail::installed_executor().store(installed, std::memory_order_release);
+}
+
+inline executor& default_executor()
+{
+    executor* installed =
+        detail::installed_executor().load(std::memory_order_acquire);
+    return installed != nullptr ? *installed : default_pool();
+}
+
+// Calls fn(i) for every i in [first, last), a task gets at least grain
+// indices unless the range is shorter
+template <typename Fn>
+void parallel_for(executor& exec,
+                  size_t first,
+                  size_t last,
+                  size_t grain,
+                  Fn&& fn)
+{
+    if (last <= first)
+    {
+        return;
+    }
+    exec.bulk_execute(last - first, grain,
+                      [&fn, first](size_t begin, size_t end)
+                      {
+                          for (size_t i = first + begin; i < first + end; ++i)
+                          {
+                              fn(i);
+                          }
+                      });
+}
+
+template <typename Fn>
+void parallel_for(size_t first, size_t last, size_t grain, Fn&& fn)
+{
+    parallel_for(default_executor(), first, last, grain, std::forward<Fn>(fn));
+}
+}  // namespace si::parallel
+
+#endif  // ENABLE_SI_PARALLEL
@@ -0,0 +1,375 @@
+#pragma once
+
+#ifdef ENABLE_SI_PARALLEL
+
+#include "si_executor.hpp"
+#include "util.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Parallel versions of the standard algorithms for ranges of big_ints and
+// strong types over them
+// The ranges are cut to chunks which are spread over the threads of an
+// executor, the partial results are combined in the order of the chunks, so
+// for an associative operation the result is the same as the sequential one,
+// which holds for the wrapping big_int addition
+namespace si::parallel
+{
+namespace detail
+{
+// A chunk fits into a typical L2 cache
+constexpr size_t l2_cache_bytes = 256 * 1024;
+// More chunks than threads, so an uneven split evens out
+constexpr size_t chunks_per_thread = 4;
+
+template <typename T>
+BIG_INT_NODISCARD size_t chunk_size(size_t count, size_t threads) noexcept
+{
+    const size_t per_cache = std::max<size_t>(1, l2_cache_bytes / sizeof(T));
+    const size_t per_task = (count + threads * chunks_per_thread - 1) /
+                            (threads * chunks_per_thread);
+    return std::max<size_t>(1, std::min(per_cache, per_task));
+}
+
+template <typename It>
+BIG_INT_NODISCARD It advance(It first, size_t count)
+{
+    return first + typename std::iterator_traits<It>::difference_type(count);
+}
+
+template <typename It>
+BIG_INT_NODISCARD size_t distance(It first, It last)
+{
+    return size_t(std::distance(first, last));
+}
+
+struct identity
+{
+    template <typename T>
+    BIG_INT_NODISCARD constexpr T&& operator()(T&& value) const noexcept
+    {
+        return std::forward<T>(value);
+    }
+};
+
+template <typename SourceIt, typename DestinationIt, typename Compare>
+void merge_round(executor& exec,
+                 SourceIt source,
+                 DestinationIt destination,
+                 size_t count,
+                 size_t width,
+                 Compare comp)
+{
+    const size_t merges = (count + 2 * width - 1) / (2 * width);
+    exec.run(merges,
+             [&](size_t merge_idx)
+             {
+                 const size_t low = merge_idx * 2 * width;
+                 const size_t middle = std::min(low + width, count);
+                 const size_t high = std::min(low + 2 * width, count);
+                 std::merge(std::make_move_iterator(advance(source, low)),
+                            std::make_move_iterator(advance(source, middle)),
+                            std::make_move_iterator(advance(source, middle)),
+                            std::make_move_iterator(advance(source, high)),
+                            advance(destination, low),
+                            comp);
+             });
+}
+}  // namespace detail
+
+template <typename It,
+          typename T,
+          typename ReduceOp,
+          typename TransformOp>
+BIG_INT_NODISCARD T transform_reduce(executor& exec,
+                                     It first,
+                                     It last,
+                                     T init,
+                                     ReduceOp reduce_op,
+                                     TransformOp transform_op)
+{
+    using value_t = std::decay_t<decltype(transform_op(*first))>;
+
+    const size_t count = detail::distance(first, last);
+    const size_t chunk = detail::chunk_size<value_t>(count, exec.concurrency());
+    const size_t chunks = (count + chunk - 1) / chunk;
+
+    std::vector<std::optional<value_t>> partials(chunks);
+    exec.run(chunks,
+             [&](size_t chunk_idx)
+             {
+                 It it = detail::advance(first, chunk_idx * chunk);
+                 const It end = detail::advance(
+                     first, std::min(count, (chunk_idx + 1) * chunk));
+
+                 value_t partial = transform_op(*it);
+                 for (++it; it != end; ++it)
+                 {
+                     partial = reduce_op(partial, transform_op(*it));
+                 }
+                 partials[chunk_idx].emplace(std::move(partial));
+             });
+
+    for (std::optional<value_t>& partial : partials)
+    {
+        init = reduce_op(init, *partial);
+    }
+    return init;
+}
+
+template <typename It,
+          typename T,
+          typename ReduceOp,
+          typename TransformOp>
+BIG_INT_NODISCARD T transform_reduce(It first,
+                                     It last,
+                                     T init,
+                                     ReduceOp reduce_op,
+                                     TransformOp transform_op)
+{
+    return parallel::transform_reduce(default_executor(), first, last,
+                                      std::move(init), reduce_op,
+                                      transform_op);
+}
+
+template <typename It, typename T, typename BinaryOp>
+BIG_INT_NODISCARD T
+reduce(executor& exec, It first, It last, T init, BinaryOp op)
+{
+    return parallel::transform_reduce(exec, first, last, std::move(init), op,
+                                      detail::identity());
+}
+
+template <typename It, typename T, typename BinaryOp>
+BIG_INT_NODISCARD T reduce(It first, It last, T init, BinaryOp op)
+{
+    return parallel::reduce(default_executor(), first, last, std::move(init),
+                            op);
+}
+
+template <typename It, typename T>
+BIG_INT_NODISCARD T reduce(It first, It last, T init)
+{
+    return parallel::reduce(default_executor(), first, last, std::move(init),
+                            std::plus<>());
+}
+
+template <typename InputIt, typename OutputIt, typename BinaryOp>
+OutputIt inclusive_scan(executor& exec,
+                        InputIt first,
+                        InputIt last,
+                        OutputIt d_first,
+                        BinaryOp op)
+{
+    using value_t = typename std::iterator_traits<InputIt>::value_type;
+
+    const size_t count = detail::distance(first, last);
+    const size_t chunk = detail::chunk_size<value_t>(count, exec.concurrency());
+    const size_t chunks = (count + chunk - 1) / chunk;
+
+    // the totals of the chunks, the last one is not needed
+    std::vector<std::optional<value_t>> totals(chunks);
+    exec.run(chunks - (chunks == 0 ? 0 : 1),
+             [&](size_t chunk_idx)
+             {
+                 InputIt it = detail::advance(first, chunk_idx * chunk);
+                 const InputIt end =
+                     detail::advance(first, (chunk_idx + 1) * chunk);
+
+                 value_t total = *it;
+                 for (++it; it != end; ++it)
+                 {
+                     total = op(total, *it);
+                 }
+                 totals[chunk_idx].emplace(std::move(total));
+             });
+
+    // then every chunk starts from the sum of everything before it
+    for (size_t chunk_idx = 1; chunk_idx + 1 < chunks; ++chunk_idx)
+    {
+        totals[chunk_idx] = op(*totals[chunk_idx - 1], *totals[chunk_idx]);
+    }
+
+    exec.run(chunks,
+             [&](size_t chunk_idx)
+             {
+                 InputIt it = detail::advance(first, chunk_idx * chunk);
+                 const InputIt end = detail::advance(
+                     first, std::min(count, (chunk_idx + 1) * chunk));
+                 OutputIt out = detail::advance(d_first, chunk_idx * chunk);
+
+                 value_t running =
+                     chunk_idx == 0 ? value_t(*it)
+                                    : value_t(op(*totals[chunk_idx - 1], *it));
+                 *out = running;
+                 for (++it, ++out; it != end; ++it, ++out)
+                 {
+                     running = op(running, *it);
+                     *out = running;
+                 }
+             });
+
+    return detail::advance(d_first, count);
+}
+
+template <typename InputIt, typename OutputIt, typename BinaryOp>
+OutputIt inclusive_scan(InputIt first,
+                        InputIt last,
+                        OutputIt d_first,
+                        BinaryOp op)
+{
+    return parallel::inclusive_scan(default_executor(), first, last, d_first,
+                                    op);
+}
+
+template <typename InputIt, typename OutputIt>
+OutputIt inclusive_scan(InputIt first, InputIt last, OutputIt d_first)
+{
+    return parallel::inclusive_scan(default_executor(), first, last, d_first,
+                                    std::plus<>());
+}
+
+// The first smallest element, like std::min_element
+template <typename It, typename Compare>
+BIG_INT_NODISCARD It min_element(executor& exec,
+                                 It first,
+                                 It last,
+                                 Compare comp)
+{
+    using value_t = typename std::iterator_traits<It>::value_type;
+
+    const size_t count = detail::distance(first, last);
+    const size_t chunk = detail::chunk_size<value_t>(count, exec.concurrency());
+    const size_t chunks = (count + chunk - 1) / chunk;
+
+    std::vector<It> smallest(chunks, last);
+    exec.run(chunks,
+             [&](size_t chunk_idx)
+             {
+                 smallest[chunk_idx] = std::min_element(
+                     detail::advance(first, chunk_idx * chunk),
+                     detail::advance(
+                         first, std::min(count, (chunk_idx + 1) * chunk)),
+                     comp);
+             });
+
+    It res = last;
+    for (const It candidate : smallest)
+    {
+        if (res == last || comp(*candidate, *res))
+        {
+            res = candidate;
+        }
+    }
+    return res;
+}
+
+template <typename It, typename Compare>
+BIG_INT_NODISCARD It min_element(It first, It last, Compare comp)
+{
+    return parallel::min_element(default_executor(), first, last, comp);
+}
+
+template <typename It>
+BIG_INT_NODISCARD It min_element(It first, It last)
+{
+    return parallel::min_element(default_executor(), first, last,
+                                 std::less<>());
+}
+
+// The first largest element, like std::max_element
+template <typename It, typename Compare>
+BIG_INT_NODISCARD It max_element(executor& exec,
+                                 It first,
+                                 It last,
+                                 Compare comp)
+{
+    return parallel::min_element(exec, first, last,
+                                 [&comp](const auto& a, const auto& b)
+                                 { return comp(b, a); });
+}
+
+template <typename It, typename Compare>
+BIG_INT_NODISCARD It max_element(It first, It last, Compare comp)
+{
+    return parallel::max_element(default_executor(), first, last, comp);
+}
+
+template <typename It>
+BIG_INT_NODISCARD It max_element(It first, It last)
+{
+    return parallel::max_element(default_executor(), first, last,
+                                 std::less<>());
+}
+
+// Stable merge sort, the chunks are sorted in parallel and then merged
+// pairwise in rounds, the result is the same as with std::stable_sort
+template <typename It, typename Compare>
+void sort(executor& exec, It first, It last, Compare comp)
+{
+    using value_t = typename std::iterator_traits<It>::value_type;
+
+    const size_t count = detail::distance(first, last);
+    const size_t chunk = detail::chunk_size<value_t>(count, exec.concurrency());
+    const size_t chunks = (count + chunk - 1) / chunk;
+
+    exec.run(chunks,
+             [&](size_t chunk_idx)
+             {
+                 std::stable_sort(
+                     detail::advance(first, chunk_idx * chunk),
+                     detail::advance(
+                         first, std::min(count, (chunk_idx + 1) * chunk)),
+                     comp);
+             });
+
+    if (chunks < 2)
+    {
+        return;
+    }
+
+    std::vector<value_t> buffer(std::make_move_iterator(first),
+                                std::make_move_iterator(last));
+    bool in_buffer = true;
+    for (size_t width = chunk; width < count; width *= 2)
+    {
+        if (in_buffer)
+        {
+            detail::merge_round(exec, buffer.begin(), first, count, width,
+                                comp);
+        }
+        else
+        {
+            detail::merge_round(exec, first, buffer.begin(), count, width,
+                                comp);
+        }
+        in_buffer = !in_buffer;
+    }
+
+    if (in_buffer)
+    {
+        std::move(buffer.begin(), buffer.end(), first);
+    }
+}
+
+template <typename It, typename Compare>
+void sort(It first, It last, Compare comp)
+{
+    parallel::sort(default_executor(), first, last, comp);
+}
+
+template <typename It>
+void sort(It first, It last)
+{
+    parallel::sort(default_executor(), first, last, std::less<>());
+}
+}  // namespace si::parallel
+
+#endif  // ENABLE_SI_PARALLEL
@@ -0,0 +1,264 @@
+#pragma once
+#include "big_int.hpp"
+#include "strong_dimensions.hpp"
+#include "strong_type.hpp"
+#include "strong_units.hpp"
+#include "util.hpp"
+
+#include <array>
+#include <stdexcept>
+
+// The exponents of the 7 SI base units packed as signed bytes in one u64, in
+// the order of dimension, the top byte stays zero
+using packed_dimension = u64;
+
+namespace detail
+{
+constexpr size_t base_unit_count = 7;
+constexpr packed_dimension exponent_sign_bits = 0x0080'8080'8080'8080ULL;
+constexpr packed_dimension exponent_value_bits = 0x007F'7F7F'7F7F'7F7FULL;
+}  // namespace detail
+
+// For exponents known at run time, they have to be in [-128, 127]
+BIG_INT_NODISCARD constexpr packed_dimension pack_dimension(
+    const std::array<int, detail::base_unit_count>& exponents) noexcept
+{
+    packed_dimension res = 0;
+    for (size_t i = 0; i < detail::base_unit_count; ++i)
+    {
+        res |= packed_dimension(u8(exponents[i])) << (i * 8);
+    }
+    return res;
+}
+
+namespace detail
+{
+template <typename Dimension>
+struct packed_dimension_of;
+
+template <int... exponents>
+struct packed_dimension_of<dimension<exponents...>>
+{
+    static constexpr packed_dimension value = pack_dimension({exponents...});
+};
+}  // namespace detail
+
+// For dimension<...>, e.g. packed_dimension_v<dimensions::force>
+template <typename Dimension>
+constexpr packed_dimension packed_dimension_v =
+    detail::packed_dimension_of<Dimension>::value;
+
+BIG_INT_NODISCARD constexpr int dimension_exponent(packed_dimension packed,
+                                                   size_t base_unit) noexcept
+{
+    return int(i8(u8(packed >> (base_unit * 8))));
+}
+
+// The exponents of all of the base units added at once, the additions of
+// the bytes are kept from carrying into each other
+BIG_INT_NODISCARD constexpr packed_dimension multiply_dimensions(
+    packed_dimension a,
+    packed_dimension b) noexcept
+{
+    return ((a & detail::exponent_value_bits) +
+            (b & detail::exponent_value_bits)) ^
+           ((a ^ b) & detail::exponent_sign_bits);
+}
+
+BIG_INT_NODISCARD constexpr packed_dimension divide_dimensions(
+    packed_dimension a,
+    packed_dimension b) noexcept
+{
+    return ((a | detail::exponent_sign_bits) -
+            (b & detail::exponent_value_bits)) ^
+           ((a ^ ~b) & detail::exponent_sign_bits);
+}
+
+// The sign bits of the exponents which left [-128, 127], a sum overflowed
+// when its sign differs from the signs of both operands
+BIG_INT_NODISCARD constexpr packed_dimension product_overflow(
+    packed_dimension a,
+    packed_dimension b,
+    packed_dimension product) noexcept
+{
+    return (a ^ product) & (b ^ product) & detail::exponent_sign_bits;
+}
+
+// a difference overflowed when the operands have different signs and its
+// sign differs from the sign of the minuend
+BIG_INT_NODISCARD constexpr packed_dimension quotient_overflow(
+    packed_dimension a,
+    packed_dimension b,
+    packed_dimension quotient) noexcept
+{
+    return (a ^ b) & (a ^ quotient) & detail::exponent_sign_bits;
+}
+
+// Quantity whose dimension is known only at run time, e.g. from the header
+// of a file, the value is in the coherent SI unit of the dimension
+// The sums check the dimensions with one comparison and throw
+// std::domain_error on a mismatch, the products add the packed exponents
+// and throw std::domain_error when one of them leaves [-128, 127]
+template <size_t size>
+class dyn_quantity
+{
+public:
+    using int_t = big_int<size>;
+
+    constexpr dyn_quantity() noexcept = default;
+
+    constexpr dyn_quantity(const int_t& init, packed_dimension dim) noexcept
+        : amount(init), packed(dim)
+    {
+    }
+
+    // From the typed world, scaled units are converted to the coherent one
+    template <typename Identifier,
+              template <typename>
+              typename... Decorators>
+    constexpr explicit dyn_quantity(
+        const strong_type<int_t, Identifier, Decorators...>& typed)
+        : amount(quantity_cast<coherent_t<Identifier>>(typed).value),
+          packed(packed_dimension_v<
+                 typename unit_traits<Identifier>::dimension_t>)
+    {
+    }
+
+    BIG_INT_NODISCARD constexpr const int_t& value() const noexcept
+    {
+        return amount;
+    }
+
+    BIG_INT_NODISCARD constexpr packed_dimension dimension() const noexcept
+    {
+        return packed;
+    }
+
+    // Checked conversion to a strong type of the same dimension, throws
+    // std::domain_error otherwise
+    template <typename Quantity>
+    BIG_INT_NODISCARD constexpr Quantity as() const
+    {
+        using identifier_t =
+            typename detail::quantity_traits<Quantity>::identifier_t;
+        check(packed_dimension_v<
+              typename unit_traits<identifier_t>::dimension_t>);
+        return quantity_cast<Quantity>(coherent_t<identifier_t>(amount));
+    }
+
+    constexpr dyn_quantity& operator+=(const dyn_quantity& other)
+    {
+        check(other.packed);
+        amount += other.amount;
+        return *this;
+    }
+
+    constexpr dyn_quantity& operator-=(const dyn_quantity& other)
+    {
+        check(other.packed);
+        amount -= other.amount;
+        return *this;
+    }
+
+    constexpr dyn_quantity& operator*=(const dyn_quantity& other)
+    {
+        const packed_dimension product =
+            multiply_dimensions(packed, other.packed);
+        check_exponents(product_overflow(packed, other.packed, product));
+        amount *= other.amount;
+        packed = product;
+        return *this;
+    }
+
+    // Truncates towards zero, throws std::domain_error for a zero divisor
+    constexpr dyn_quantity& operator/=(const dyn_quantity& other)
+    {
+        const packed_dimension quotient =
+            divide_dimensions(packed, other.packed);
+        check_exponents(quotient_overflow(packed, other.packed, quotient));
+        amount /= other.amount;
+        packed = quotient;
+        return *this;
+    }
+
+    BIG_INT_NODISCARD constexpr dyn_quantity operator+(
+        const dyn_quantity& other) const
+    {
+        dyn_quantity res = *this;
+        res += other;
+        return res;
+    }
+
+    BIG_INT_NODISCARD constexpr dyn_quantity operator-(
+        const dyn_quantity& other) const
+    {
+        dyn_quantity res = *this;
+        res -= other;
+        return res;
+    }
+
+    BIG_INT_NODISCARD constexpr dyn_quantity operator*(
+        const dyn_quantity& other) const
+    {
+        dyn_quantity res = *this;
+        res *= other;
+        return res;
+    }
+
+    BIG_INT_NODISCARD constexpr dyn_quantity operator/(
+        const dyn_quantity& other) const
+    {
+        dyn_quantity res = *this;
+        res /= other;
+        return res;
+    }
+
+    BIG_INT_NODISCARD constexpr dyn_quantity operator-() const noexcept
+    {
+        return dyn_quantity(-amount, packed);
+    }
+
+    // Quantities of different dimensions are never equal
+    BIG_INT_NODISCARD constexpr bool operator==(
+        const dyn_quantity& other) const noexcept
+    {
+        return packed == other.packed && amount == other.amount;
+    }
+
+    BIG_INT_NODISCARD constexpr bool operator!=(
+        const dyn_quantity& other) const noexcept
+    {
+        return !(*this == other);
+    }
+
+    // Throws std::domain_error for different dimensions
+    BIG_INT_NODISCARD constexpr bool operator<(const dyn_quantity& other) const
+    {
+        check(other.packed);
+        return amount < other.amount;
+    }
+
+private:
+    template <typename Identifier>
+    using coherent_t =
+        strong_type<int_t, typename unit_traits<Identifier>::dimension_t>;
+
+    constexpr void check(packed_dimension expected) const
+    {
+        if (packed != expected)
+        {
+            throw std::domain_error("Mismatched dimensions!");
+        }
+    }
+
+    static constexpr void check_exponents(packed_dimension overflow)
+    {
+        if (overflow != 0)
+        {
+            throw std::domain_error("Dimension exponent out of range!");
+        }
+    }
+
+    int_t amount;
+    packed_dimension packed = 0;
+};
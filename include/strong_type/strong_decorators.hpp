@@ -1,8 +1,16 @@
 #pragma once
 
+#include <type_traits>
+#include <utility>
+
 template <typename underlying_t, template <typename> typename current>
 struct crtp
 {
+    constexpr underlying_t& underlying()
+    {
+        return static_cast<underlying_t&>(*this);
+    }
+
     constexpr const underlying_t& underlying() const
     {
         return static_cast<const underlying_t&>(*this);
@@ -35,22 +43,199 @@ struct addable : crtp<underlying_t, addable>
     }
 };
 
+// uses the predefined - operators of the strong type's base type
+template <typename underlying_t>
+struct subtractable : crtp<underlying_t, subtractable>
+{
+    using sub_res_t = typename units_added<underlying_t, underlying_t>::type;
+
+    constexpr sub_res_t subtract(const underlying_t& other) const
+    {
+        return sub_res_t(this->underlying().value - other.value);
+    }
+
+    constexpr sub_res_t operator-(const underlying_t& other) const
+    {
+        return sub_res_t(this->underlying().value - other.value);
+    }
+
+    constexpr underlying_t operator-() const
+    {
+        return underlying_t(-this->underlying().value);
+    }
+
+    constexpr underlying_t& operator-=(const underlying_t& other)
+    {
+        this->underlying().value -= other.value;
+        return this->underlying();
+    }
+};
+
+// accumulates in place with the += operator of the base type
+template <typename underlying_t>
+struct compound_addable : crtp<underlying_t, compound_addable>
+{
+    constexpr underlying_t& operator+=(const underlying_t& other)
+    {
+        this->underlying().value += other.value;
+        return this->underlying();
+    }
+};
+
+// compares only values of the same strong type
+template <typename underlying_t>
+struct comparable : crtp<underlying_t, comparable>
+{
+    constexpr bool operator==(const underlying_t& other) const
+    {
+        return this->underlying().value == other.value;
+    }
+
+    constexpr bool operator!=(const underlying_t& other) const
+    {
+        return this->underlying().value != other.value;
+    }
+
+    constexpr bool operator<(const underlying_t& other) const
+    {
+        return this->underlying().value < other.value;
+    }
+
+    constexpr bool operator<=(const underlying_t& other) const
+    {
+        return this->underlying().value <= other.value;
+    }
+
+    constexpr bool operator>(const underlying_t& other) const
+    {
+        return this->underlying().value > other.value;
+    }
+
+    constexpr bool operator>=(const underlying_t& other) const
+    {
+        return this->underlying().value >= other.value;
+    }
+};
+
+// scales by a dimensionless factor, which is anything the base type is
+// multiplied or divided by in place, the unit stays the same
+// for big_int, the built-in integers take the single limb loops without a
+// conversion, e.g. 2 * length or length / 3
+template <typename underlying_t>
+struct scalable : crtp<underlying_t, scalable>
+{
+    // the strong type is still incomplete here, so the checks are deferred
+    // until the factor type is known
+    template <typename scalar_t>
+    struct deferred
+    {
+        using value_t = decltype(std::declval<underlying_t&>().value);
+    };
+
+    template <typename scalar_t, typename res_t>
+    using if_multiplies_t = std::conditional_t<
+        true,
+        res_t,
+        decltype(std::declval<typename deferred<scalar_t>::value_t&>() *=
+                 std::declval<const scalar_t&>())>;
+
+    template <typename scalar_t, typename res_t>
+    using if_divides_t = std::conditional_t<
+        true,
+        res_t,
+        decltype(std::declval<typename deferred<scalar_t>::value_t&>() /=
+                 std::declval<const scalar_t&>())>;
+
+    template <typename scalar_t>
+    constexpr if_multiplies_t<scalar_t, underlying_t&> operator*=(
+        const scalar_t& factor)
+    {
+        this->underlying().value *= factor;
+        return this->underlying();
+    }
+
+    template <typename scalar_t>
+    constexpr if_divides_t<scalar_t, underlying_t&> operator/=(
+        const scalar_t& divisor)
+    {
+        this->underlying().value /= divisor;
+        return this->underlying();
+    }
+
+    // friends, so they do not hide the operator* of multipliable, the
+    // quantity is taken by value to reuse the storage of a temporary
+    template <typename scalar_t>
+    friend constexpr if_multiplies_t<scalar_t, underlying_t> operator*(
+        underlying_t scaled, const scalar_t& factor)
+    {
+        scaled.value *= factor;
+        return scaled;
+    }
+
+    template <typename scalar_t>
+    friend constexpr if_multiplies_t<scalar_t, underlying_t> operator*(
+        const scalar_t& factor, underlying_t scaled)
+    {
+        scaled.value *= factor;
+        return scaled;
+    }
+
+    template <typename scalar_t>
+    friend constexpr if_divides_t<scalar_t, underlying_t> operator/(
+        underlying_t scaled, const scalar_t& divisor)
+    {
+        scaled.value /= divisor;
+        return scaled;
+    }
+};
+
 template <typename a, typename b>
 struct units_multiplied;
 
+// the product and the quotient may be of any strong type the units are
+// defined for, e.g. by the dimensions in strong_dimensions.hpp
 template <typename underlying_t>
 struct multipliable : crtp<underlying_t, multipliable>
 {
+    template <typename other_t>
     using multiplication_res_t =
-        typename units_multiplied<underlying_t, underlying_t>::type;
+        typename units_multiplied<underlying_t, other_t>::type;
+
+    template <typename other_t>
+    constexpr multiplication_res_t<other_t> multiply(
+        const other_t& other) const
+    {
+        return multiplication_res_t<other_t>(this->underlying().value *
+                                             other.value);
+    }
 
-    constexpr multiplication_res_t multiply(const underlying_t& other) const
+    template <typename other_t>
+    constexpr multiplication_res_t<other_t> operator*(
+        const other_t& other) const
     {
-        return multiplication_res_t(this->underlying().value * other.value);
+        return multiplication_res_t<other_t>(this->underlying().value *
+                                             other.value);
     }
+};
+
+template <typename a, typename b>
+struct units_divided;
+
+template <typename underlying_t>
+struct dividable : crtp<underlying_t, dividable>
+{
+    template <typename other_t>
+    using division_res_t = typename units_divided<underlying_t, other_t>::type;
 
-    constexpr multiplication_res_t operator*(const underlying_t& other) const
+    template <typename other_t>
+    constexpr division_res_t<other_t> divide(const other_t& other) const
     {
-        return multiplication_res_t(this->underlying().value * other.value);
+        return division_res_t<other_t>(this->underlying().value / other.value);
     }
-};
\ No newline at end of file
+
+    template <typename other_t>
+    constexpr division_res_t<other_t> operator/(const other_t& other) const
+    {
+        return division_res_t<other_t>(this->underlying().value / other.value);
+    }
+};
@@ -0,0 +1,105 @@
+#pragma once
+#include "strong_decorators.hpp"
+#include "strong_type.hpp"
+
+// Dimensions as the exponents of the SI base units, used as the identifier
+// of a strong type, so the units of products and quotients follow from the
+// exponents instead of a specialization for every pair of types
+// The order is length, mass, time, electric current, thermodynamic
+// temperature, amount of substance and luminous intensity
+template <int length,
+          int mass,
+          int time,
+          int current,
+          int temperature,
+          int amount,
+          int intensity>
+struct dimension
+{
+};
+
+template <typename a, typename b>
+struct dimension_product;
+
+template <int... a, int... b>
+struct dimension_product<dimension<a...>, dimension<b...>>
+{
+    using type = dimension<(a + b)...>;
+};
+
+template <typename a, typename b>
+using dimension_product_t = typename dimension_product<a, b>::type;
+
+template <typename a, typename b>
+struct dimension_quotient;
+
+template <int... a, int... b>
+struct dimension_quotient<dimension<a...>, dimension<b...>>
+{
+    using type = dimension<(a - b)...>;
+};
+
+template <typename a, typename b>
+using dimension_quotient_t = typename dimension_quotient<a, b>::type;
+
+template <typename a, int exponent>
+struct dimension_power;
+
+template <int... a, int exponent>
+struct dimension_power<dimension<a...>, exponent>
+{
+    using type = dimension<(a * exponent)...>;
+};
+
+template <typename a, int exponent>
+using dimension_power_t = typename dimension_power<a, exponent>::type;
+
+// the result has the operations of the left operand
+template <typename T,
+          int... a,
+          int... b,
+          template <typename>
+          typename... Decorators,
+          template <typename>
+          typename... OtherDecorators>
+struct units_multiplied<strong_type<T, dimension<a...>, Decorators...>,
+                        strong_type<T, dimension<b...>, OtherDecorators...>>
+{
+    using type = strong_type<T, dimension<(a + b)...>, Decorators...>;
+};
+
+template <typename T,
+          int... a,
+          int... b,
+          template <typename>
+          typename... Decorators,
+          template <typename>
+          typename... OtherDecorators>
+struct units_divided<strong_type<T, dimension<a...>, Decorators...>,
+                     strong_type<T, dimension<b...>, OtherDecorators...>>
+{
+    using type = strong_type<T, dimension<(a - b)...>, Decorators...>;
+};
+
+namespace dimensions
+{
+using dimensionless = dimension<0, 0, 0, 0, 0, 0, 0>;
+
+using length = dimension<1, 0, 0, 0, 0, 0, 0>;
+using mass = dimension<0, 1, 0, 0, 0, 0, 0>;
+using time = dimension<0, 0, 1, 0, 0, 0, 0>;
+using current = dimension<0, 0, 0, 1, 0, 0, 0>;
+using temperature = dimension<0, 0, 0, 0, 1, 0, 0>;
+using amount = dimension<0, 0, 0, 0, 0, 1, 0>;
+using intensity = dimension<0, 0, 0, 0, 0, 0, 1>;
+
+using area = dimension_power_t<length, 2>;
+using volume = dimension_power_t<length, 3>;
+using frequency = dimension_power_t<time, -1>;
+using velocity = dimension_quotient_t<length, time>;
+using acceleration = dimension_quotient_t<velocity, time>;
+using force = dimension_product_t<mass, acceleration>;
+using energy = dimension_product_t<force, length>;
+using power = dimension_quotient_t<energy, time>;
+using charge = dimension_product_t<current, time>;
+}  // namespace dimensions
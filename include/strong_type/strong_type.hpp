@@ -23,53 +23,41 @@ struct strong_type
     }
 
     template <typename = std::enable_if_t<std::is_copy_constructible<T>::value>>
-    constexpr explicit strong_type(const T& value) noexcept(
+    constexpr explicit strong_type(const T& init) noexcept(
         std::is_nothrow_copy_constructible<T>::value)
-        : value(value)
-    {
-    }
-
-    template <typename = std::enable_if_t<std::is_copy_constructible<T>::value>>
-    constexpr explicit strong_type(const strong_type& other) noexcept(
-        std::is_nothrow_copy_constructible<T>::value)
-        : value(other.value)
+        : value(init)
     {
     }
 
     // assignment is not preferrable as it introduces conversions
     strong_type& operator=(const T& value) = delete;
 
-    template <typename = std::enable_if_t<std::is_copy_assignable<T>::value>>
-    constexpr strong_type operator=(const strong_type& other) noexcept(
-        std::is_nothrow_copy_assignable<T>::value)
-    {
-        value = other.value;
-        return *this;
-    }
-
     template <typename = std::enable_if_t<std::is_move_constructible<T>::value>>
-    constexpr explicit strong_type(T&& value) noexcept(
+    constexpr explicit strong_type(T&& init) noexcept(
         std::is_nothrow_move_constructible<T>::value)
-        : value(std::move(value))
-    {
-    }
-
-    template <typename = std::enable_if_t<std::is_move_constructible<T>::value>>
-    constexpr explicit strong_type(strong_type&& other) noexcept(
-        std::is_nothrow_move_constructible<T>::value)
-        : value(std::move(other.value))
+        : value(std::move(init))
     {
     }
 
     // assignment is not preferrable as it introduces conversions
     strong_type& operator=(T&& value) = delete;
 
-    template <typename = std::enable_if_t<std::is_move_assignable<T>::value>>
-    constexpr strong_type& operator=(strong_type&& other) noexcept(
-        std::is_nothrow_move_assignable<T>::value)
+    // defaulted, so a trivially copyable T gives a trivially copyable
+    // strong type, which can be copied with memcpy
+    strong_type(const strong_type&) = default;
+    strong_type(strong_type&&) = default;
+    strong_type& operator=(const strong_type&) = default;
+    strong_type& operator=(strong_type&&) = default;
+    ~strong_type() = default;
+
+    // the same quantity with another set of operations, explicit so the
+    // operations of a value do not change silently
+    template <template <typename> typename... OtherDecorators>
+    constexpr explicit strong_type(
+        const strong_type<T, Identifier, OtherDecorators...>& other) noexcept(
+        std::is_nothrow_copy_constructible<T>::value)
+        : value(other.value)
     {
-        value = std::move(other.value);
-        return *this;
     }
 
     constexpr explicit operator T() const noexcept { return value; }
@@ -79,4 +67,4 @@ struct strong_type
 
     // contained on the stack like a usual variable
     T value;
-};
\ No newline at end of file
+};
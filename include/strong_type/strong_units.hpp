@@ -0,0 +1,165 @@
+#pragma once
+#include "strong_dimensions.hpp"
+#include "strong_type.hpp"
+
+#include <cstdint>
+#include <ratio>
+#include <type_traits>
+
+// Units which are an exact multiple of the coherent SI unit of a dimension,
+// the factor is ratio * 10^exponent, so small constants such as the
+// electronvolt do not overflow the std::intmax_t of std::ratio
+template <typename Dimension, typename Ratio, int exponent = 0>
+struct scaled_unit
+{
+};
+
+namespace detail
+{
+constexpr int trailing_tens(std::intmax_t value) noexcept
+{
+    int res = 0;
+    for (; value % 10 == 0; value /= 10)
+    {
+        ++res;
+    }
+    return res;
+}
+
+template <typename T>
+constexpr T decimal_power(int exponent) noexcept
+{
+    T res(1);
+    for (int i = 0; i < exponent; ++i)
+    {
+        res *= T(10);
+    }
+    return res;
+}
+
+// Moves the powers of ten of a ratio into an exponent, so the prefixes do
+// not overflow std::ratio when combined with other factors
+template <typename Ratio>
+struct decimal_ratio
+{
+    static constexpr int num_tens = trailing_tens(Ratio::num);
+    static constexpr int den_tens = trailing_tens(Ratio::den);
+
+    using ratio_t =
+        std::ratio<Ratio::num / decimal_power<std::intmax_t>(num_tens),
+                   Ratio::den / decimal_power<std::intmax_t>(den_tens)>;
+    static constexpr int exponent = num_tens - den_tens;
+};
+}  // namespace detail
+
+template <typename Identifier>
+struct unit_traits;
+
+template <int... exponents>
+struct unit_traits<dimension<exponents...>>
+{
+    using dimension_t = dimension<exponents...>;
+    using ratio_t = std::ratio<1>;
+    static constexpr int exponent = 0;
+};
+
+template <typename Dimension, typename Ratio, int unit_exponent>
+struct unit_traits<scaled_unit<Dimension, Ratio, unit_exponent>>
+{
+    using dimension_t = Dimension;
+    using ratio_t = typename detail::decimal_ratio<Ratio>::ratio_t;
+    static constexpr int exponent =
+        unit_exponent + detail::decimal_ratio<Ratio>::exponent;
+};
+
+// e.g. prefixed_t<std::kilo, dimensions::length> for kilometers
+template <typename Prefix, typename Identifier>
+using prefixed_t = scaled_unit<
+    typename unit_traits<Identifier>::dimension_t,
+    std::ratio_multiply<typename detail::decimal_ratio<Prefix>::ratio_t,
+                        typename unit_traits<Identifier>::ratio_t>,
+    detail::decimal_ratio<Prefix>::exponent +
+        unit_traits<Identifier>::exponent>;
+
+namespace units
+{
+using minute = scaled_unit<dimensions::time, std::ratio<60>>;
+using hour = scaled_unit<dimensions::time, std::ratio<3600>>;
+using day = scaled_unit<dimensions::time, std::ratio<86400>>;
+using liter = scaled_unit<dimensions::volume, std::ratio<1, 1000>>;
+using tonne = scaled_unit<dimensions::mass, std::ratio<1000>>;
+using electronvolt =
+    scaled_unit<dimensions::energy, std::ratio<1'602'176'634>, -28>;
+}  // namespace units
+
+namespace detail
+{
+template <typename Quantity>
+struct quantity_traits;
+
+template <typename T,
+          typename Identifier,
+          template <typename>
+          typename... Decorators>
+struct quantity_traits<strong_type<T, Identifier, Decorators...>>
+{
+    using value_t = T;
+    using identifier_t = Identifier;
+};
+
+// The factor from the unit From to the unit To as multiplier / divisor
+template <typename T, typename From, typename To>
+struct conversion_factor
+{
+    static_assert(std::is_same<typename unit_traits<From>::dimension_t,
+                               typename unit_traits<To>::dimension_t>::value,
+                  "Only units of the same dimension convert to each other!");
+
+    using quotient_t = decimal_ratio<
+        std::ratio_divide<typename unit_traits<From>::ratio_t,
+                          typename unit_traits<To>::ratio_t>>;
+
+    using ratio_t = typename quotient_t::ratio_t;
+    static constexpr int exponent = quotient_t::exponent +
+                                    unit_traits<From>::exponent -
+                                    unit_traits<To>::exponent;
+
+    static constexpr bool multiplies = ratio_t::num != 1 || exponent > 0;
+    static constexpr bool divides = ratio_t::den != 1 || exponent < 0;
+
+    static constexpr T multiplier =
+        T(ratio_t::num) * decimal_power<T>(exponent > 0 ? exponent : 0);
+    static constexpr T divisor =
+        T(ratio_t::den) * decimal_power<T>(exponent < 0 ? -exponent : 0);
+};
+}  // namespace detail
+
+// Converts between units of the same dimension, the factor is folded at
+// compile time, so the conversion is one multiplication or division by a
+// constant, or nothing between equal units
+// Integers are multiplied first and then divided, which truncates
+template <typename To,
+          typename T,
+          typename Identifier,
+          template <typename>
+          typename... Decorators>
+constexpr To quantity_cast(
+    const strong_type<T, Identifier, Decorators...>& from)
+{
+    using to_traits = detail::quantity_traits<To>;
+    static_assert(std::is_same<typename to_traits::value_t, T>::value,
+                  "The quantities have to be of the same type!");
+    using factor_t = detail::
+        conversion_factor<T, Identifier, typename to_traits::identifier_t>;
+
+    T res = from.value;
+    if constexpr (factor_t::multiplies)
+    {
+        res *= factor_t::multiplier;
+    }
+    if constexpr (factor_t::divides)
+    {
+        res /= factor_t::divisor;
+    }
+    return To(res);
+}
@@ -5,32 +5,32 @@
 #include "big_int.hpp"
 #include "big_int_std_integration.hpp"
 #include "strong_decorators.hpp"
+#include "strong_dimensions.hpp"
 #include "strong_type.hpp"
 
-using meter =
-    strong_type<big_int<128>, struct _length_tag, addable, multipliable>;
-using sq_meter = strong_type<big_int<128>, struct _area_tag, addable>;
+using meter = strong_type<big_int<128>,
+                          dimensions::length,
+                          addable,
+                          multipliable,
+                          dividable>;
+using sq_meter = strong_type<big_int<128>, dimensions::area, addable>;
 
-using second = strong_type<big_int<128>, struct _time_tag, addable>;
-
-template <>
-struct units_multiplied<meter, meter>
-{
-    using type = sq_meter;
-};
+using second = strong_type<big_int<128>, dimensions::time, addable>;
+using meter_per_second = strong_type<big_int<128>, dimensions::velocity>;
 
 // TODO : strong vectors - different spaces - different types
 
 int main()
 {
-    auto len = meter(2);
-    auto time = second(2_bi);
+    const auto len = meter(2);
+    const auto time = second(2);
 
-    meter sum_len = len + len;
-    sq_meter area = len * len + len * len;
-    second sum_time = time + time;
+    const meter sum_len = len + len;
+    const sq_meter area(len * len + len * len);
+    const second sum_time = time + time;
+    const meter_per_second speed(sum_len / sum_time);
     // len + time; // NOT OK!
-    return 0;
+    return area.value == 8 && speed.value == 1 ? 0 : 1;
 }
 
 /*
@@ -0,0 +1,106 @@
+#include "catch2/catch_all.hpp"
+
+#include "big_int_accumulator.hpp"
+#include "strong_dimensions.hpp"
+
+#ifdef ENABLE_BIG_INT_UTIL
+
+using length =
+    strong_type<big_int<16>, struct accumulator_length_tag, addable>;
+
+TEST_CASE("Accumulator matches repeated addition", "[accumulator]")
+{
+    accumulator<big_int<64>> sum;
+    big_int<64> expected;
+    for (long long i = -50'000; i < 70'000; i += 7)
+    {
+        const big_int<64> value = big_int<64>(i) * big_int<64>(i) * i;
+        sum += value;
+        expected += value;
+    }
+    REQUIRE(sum.value() == expected);
+
+    STATIC_REQUIRE(accumulator<big_int<8>>(big_int<8>(-5)).value() ==
+                   big_int<8>(-5));
+}
+
+TEST_CASE("Accumulator normalizes when the lanes are full", "[accumulator]")
+{
+    // every lane receives 0xFF, more times than the lanes could hold
+    constexpr int adds = 17'000'000;
+    accumulator<big_int<4>> sum;
+    for (int i = 0; i < adds; ++i)
+    {
+        sum.add(big_int<4>(-1));
+    }
+    REQUIRE(sum.value() == big_int<4>(-adds));
+}
+
+TEST_CASE("Accumulator keeps the unit", "[accumulator]")
+{
+    accumulator<length> total(length(big_int<16>(3)));
+    for (int i = 0; i < 100; ++i)
+    {
+        total += length(big_int<16>(i));
+    }
+    REQUIRE(total.value().value == big_int<16>(4'953));
+}
+
+TEST_CASE("Accumulator adds products", "[accumulator]")
+{
+    accumulator<big_int<32>> dot;
+    accumulator<big_int<32>> scaled;
+    big_int<32> expected_dot;
+    big_int<32> expected_scaled;
+    for (long long i = -3'000; i < 3'000; i += 11)
+    {
+        const big_int<32> a = big_int<32>(i) * i * i;
+        const big_int<32> b = big_int<32>(i - 77) * 1'000'003;
+        const u64 factor = u64(i + 3'000) * 0x0123'4567'89ABULL;
+
+        dot.mul_add(a, b);
+        scaled.mul_add_small(a, factor);
+        expected_dot += a * b;
+        expected_scaled += a * big_int<32>(factor);
+    }
+    REQUIRE(dot.value() == expected_dot);
+    REQUIRE(scaled.value() == expected_scaled);
+
+    // sizes which are not a whole count of 32 bit limbs
+    accumulator<big_int<13>> odd;
+    big_int<13> expected_odd;
+    big_int<13> x = -123'456'789;
+    for (int i = 0; i < 200; ++i)
+    {
+        x = x * big_int<13>(1'000'003) + big_int<13>(i);
+        odd.mul_add(x, x);
+        odd.mul_add_small(x, u64(i) << 40 | 0xFFU);
+        expected_odd += x * x + x * big_int<13>(u64(i) << 40 | 0xFFU);
+    }
+    REQUIRE(odd.value() == expected_odd);
+
+    // the products wrap like the operators
+    accumulator<big_int<4>> wrapped;
+    wrapped.mul_add(big_int<4>(-1), big_int<4>(0x7FFF'FFFF));
+    wrapped.mul_add_small(big_int<4>(0x1234'5678), ~u64(0));
+    REQUIRE(wrapped.value() ==
+            big_int<4>(-0x7FFF'FFFF) - big_int<4>(0x1234'5678));
+}
+
+using newton = strong_type<big_int<16>, dimensions::force, multipliable>;
+using meter = strong_type<big_int<16>, dimensions::length>;
+using joule = strong_type<big_int<16>, dimensions::energy, addable>;
+
+TEST_CASE("Accumulator adds products of the unit", "[accumulator]")
+{
+    accumulator<joule> work;
+    for (int i = 1; i <= 10; ++i)
+    {
+        work.mul_add(newton(big_int<16>(i)), meter(big_int<16>(i + 1)));
+    }
+    work.mul_add_small(joule(big_int<16>(5)), 4);
+    REQUIRE(work.value().value == big_int<16>(460));
+    // work.mul_add(meter(1), meter(1)); // does not compile
+}
+
+#endif  // ENABLE_BIG_INT_UTIL
@@ -0,0 +1,99 @@
+#include "catch2/catch_all.hpp"
+
+#include "big_int_array.hpp"
+
+#ifdef ENABLE_BIG_INT_BATCH
+
+#include <vector>
+
+template <size_t size>
+static std::vector<big_int<size>> sample_values(size_t count, long long seed)
+{
+    std::vector<big_int<size>> values;
+    big_int<size> value = seed;
+    for (size_t i = 0; i < count; ++i)
+    {
+        value = value * big_int<size>(-1'000'003) + big_int<size>(seed);
+        // a few extremes, so the carries run through all the limbs
+        values.push_back(i % 7 == 0 ? big_int<size>(-1) : value);
+    }
+    return values;
+}
+
+TEST_CASE("Array of structures round trip", "[batch]")
+{
+    const auto values = sample_values<24>(300, 17);
+    const big_int_array<24> array(values.data(), values.size());
+
+    REQUIRE(array.size() == 300);
+    REQUIRE(array.stride() % big_int_array<24>::alignment == 0);
+    for (size_t k = 0; k < 24; ++k)
+    {
+        REQUIRE(reinterpret_cast<std::uintptr_t>(array.limb(k)) %
+                    big_int_array<24>::alignment ==
+                0);
+    }
+
+    std::vector<big_int<24>> stored(values.size());
+    array.store(stored.data());
+    REQUIRE(stored == values);
+
+    big_int_array<24> resized = array;
+    resized.resize(400);
+    REQUIRE(resized.get(299) == values[299]);
+    REQUIRE(resized.get(399) == big_int<24>(0));
+}
+
+TEST_CASE("Batched kernels match the scalar operators", "[batch]")
+{
+    const auto lhs = sample_values<17>(600, 5);
+    const auto rhs = sample_values<17>(600, -3);
+    const big_int_array<17> a(lhs.data(), lhs.size());
+    const big_int_array<17> b(rhs.data(), rhs.size());
+    big_int_array<17> out(lhs.size());
+    std::vector<i8> order(lhs.size());
+
+    add(a, b, out);
+    for (size_t i = 0; i < lhs.size(); ++i)
+    {
+        REQUIRE(out.get(i) == lhs[i] + rhs[i]);
+    }
+
+    sub(a, b, out);
+    for (size_t i = 0; i < lhs.size(); ++i)
+    {
+        REQUIRE(out.get(i) == lhs[i] - rhs[i]);
+    }
+
+    negate(a, out);
+    for (size_t i = 0; i < lhs.size(); ++i)
+    {
+        REQUIRE(out.get(i) == -lhs[i]);
+    }
+
+    bit_xor(a, b, out);
+    for (size_t i = 0; i < lhs.size(); ++i)
+    {
+        REQUIRE(out.get(i) == (lhs[i] ^ rhs[i]));
+    }
+
+    bit_not(a, out);
+    for (size_t i = 0; i < lhs.size(); ++i)
+    {
+        REQUIRE(out.get(i) == ~lhs[i]);
+    }
+
+    compare(a, b, order.data());
+    for (size_t i = 0; i < lhs.size(); ++i)
+    {
+        REQUIRE(order[i] == i8(int(rhs[i] < lhs[i]) - int(lhs[i] < rhs[i])));
+    }
+
+    compare(a, a, order.data());
+    for (size_t i = 0; i < lhs.size(); ++i)
+    {
+        REQUIRE(order[i] == 0);
+    }
+}
+
+#endif  // ENABLE_BIG_INT_BATCH
@@ -0,0 +1,90 @@
+#include "catch2/catch_all.hpp"
+
+#include "big_int_atomic.hpp"
+
+#ifdef ENABLE_SI_PARALLEL
+
+#include <thread>
+#include <vector>
+
+template <typename Fn>
+static void run_threads(size_t count, Fn fn)
+{
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < count; ++i)
+    {
+        threads.emplace_back(fn);
+    }
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+}
+
+#ifdef BIG_INT_HAS_CAS16
+TEST_CASE("16 byte atomic is lock-free", "[atomic]")
+{
+    STATIC_REQUIRE(atomic_big_int<16>::is_always_lock_free);
+    STATIC_REQUIRE(!atomic_big_int<32>::is_always_lock_free);
+}
+#endif  // BIG_INT_HAS_CAS16
+
+TEMPLATE_TEST_CASE_SIG("Atomic big_int operations",
+                       "[atomic]",
+                       ((size_t size), size),
+                       16,
+                       32)
+{
+    atomic_big_int<size> value(big_int<size>(5));
+    REQUIRE(value.load() == big_int<size>(5));
+
+    big_int<size> expected = 4;
+    REQUIRE(!value.compare_exchange_strong(expected, big_int<size>(9)));
+    REQUIRE(expected == big_int<size>(5));
+    REQUIRE(value.compare_exchange_strong(expected, big_int<size>(-9)));
+    REQUIRE(value.load() == big_int<size>(-9));
+
+    REQUIRE(value.exchange(big_int<size>(1)) == big_int<size>(-9));
+    REQUIRE(value.fetch_sub(big_int<size>(3)) == big_int<size>(1));
+    value.store(big_int<size>(-1));
+    REQUIRE(value.fetch_add(big_int<size>(1)) == big_int<size>(-1));
+    REQUIRE(value.load() == big_int<size>(0));
+}
+
+TEMPLATE_TEST_CASE_SIG("Concurrent adds are not lost",
+                       "[atomic]",
+                       ((size_t size), size),
+                       16,
+                       32)
+{
+    // the step carries over the lower 64 bits on every other add
+    const big_int<size> step = big_int<size>(1) << 63;
+    constexpr int adds = 20'000;
+    constexpr size_t threads = 4;
+
+    atomic_big_int<size> total;
+    run_threads(threads,
+                [&]
+                {
+                    for (int i = 0; i < adds; ++i)
+                    {
+                        static_cast<void>(total.fetch_add(step));
+                    }
+                });
+    REQUIRE(total.load() ==
+            step * big_int<size>(adds) * big_int<size>(threads));
+
+    sharded_counter<size> counter(3);
+    run_threads(threads * 2,
+                [&]
+                {
+                    for (int i = 0; i < adds; ++i)
+                    {
+                        counter.add(big_int<size>(i));
+                    }
+                });
+    REQUIRE(counter.load() == big_int<size>(adds) * (adds - 1) / 2 *
+                                  big_int<size>(threads * 2));
+}
+
+#endif  // ENABLE_SI_PARALLEL
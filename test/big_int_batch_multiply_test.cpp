@@ -0,0 +1,44 @@
+#include "catch2/catch_all.hpp"
+
+#include "big_int_batch_multiply.hpp"
+
+#ifdef ENABLE_BIG_INT_BATCH
+
+#include <vector>
+
+template <size_t size>
+static void check_multiply_many(size_t count)
+{
+    std::vector<big_int<size>> a;
+    std::vector<big_int<size>> b;
+    big_int<size> x = 12'345;
+    big_int<size> y = -777;
+    for (size_t i = 0; i < count; ++i)
+    {
+        x = x * big_int<size>(1'000'003) + big_int<size>(int(i));
+        y = y * big_int<size>(-65'521) + big_int<size>(1);
+        a.push_back(i % 3 == 0 ? big_int<size>(-1) : x);
+        b.push_back(y);
+    }
+
+    std::vector<big_int<size>> out(count);
+    multiply_many(a.data(), b.data(), out.data(), count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        REQUIRE(out[i] == a[i] * b[i]);
+    }
+
+    // in place
+    multiply_many(a.data(), b.data(), a.data(), count);
+    REQUIRE(a == out);
+}
+
+TEST_CASE("multiply_many matches operator*", "[batch]")
+{
+    check_multiply_many<4>(103);
+    check_multiply_many<16>(103);
+    check_multiply_many<31>(50);
+    check_multiply_many<128>(21);
+}
+
+#endif  // ENABLE_BIG_INT_BATCH
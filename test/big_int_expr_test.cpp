@@ -0,0 +1,89 @@
+#include "catch2/catch_all.hpp"
+
+#include "big_int_expr.hpp"
+
+#ifdef ENABLE_BIG_INT_EXPR
+
+using expr::lazy;
+
+template <size_t size>
+static big_int<size> random_number(u32 seed, size_t length = size)
+{
+    big_int<size> res;
+    u32 state = seed;
+    for (size_t i = 0; i < length; ++i)
+    {
+        state = state * 1'103'515'245U + 12'345U;
+        res.raw[i] = u8(state >> 16);
+    }
+    return res;
+}
+
+TEMPLATE_TEST_CASE_SIG("Fused expressions match the eager operators",
+                       "[expr]",
+                       ((size_t size), size),
+                       1,
+                       8,
+                       33,
+                       128)
+{
+    for (u32 seed = 1; seed < 40; ++seed)
+    {
+        const size_t length = seed % size + 1;
+        const big_int<size> a = random_number<size>(seed, length);
+        const big_int<size> b = random_number<size>(seed * 3, size);
+        const big_int<size> c = -random_number<size>(seed * 5, length);
+        const big_int<size> d = random_number<size>(seed * 7, length / 2);
+
+        const big_int<size> products = lazy(a) * lazy(b) + lazy(c) * lazy(d);
+        REQUIRE(products == a * b + c * d);
+
+        const big_int<size> sums = lazy(a) + lazy(b) + lazy(c);
+        REQUIRE(sums == a + b + c);
+
+        const big_int<size> fused = lazy(a) * lazy(b) + lazy(c);
+        REQUIRE(fused == a * b + c);
+        REQUIRE((lazy(c) + lazy(a) * lazy(b)).eval() == c + a * b);
+    }
+}
+
+TEST_CASE("Fused expressions wrap like the eager operators", "[expr]")
+{
+    const big_int<8> max = 0x7FFF'FFFF'FFFF'FFFFLL;
+    const big_int<8> min = -max - 1;
+
+    const big_int<8> wrapped = lazy(max) * lazy(max) + lazy(max) + lazy(min);
+    REQUIRE(wrapped == max * max + max + min);
+
+    const big_int<8> minus_one = -1;
+    const big_int<8> squares =
+        lazy(minus_one) * lazy(minus_one) + lazy(min) * lazy(minus_one);
+    REQUIRE(squares == min + 1);
+}
+
+TEST_CASE("Fused expressions may assign to their operands", "[expr]")
+{
+    big_int<16> a = 1'234'567;
+    const big_int<16> b = -89;
+    const big_int<16> expected = a * a + a * b + b;
+
+    expr::assign(a, lazy(a) * lazy(a) + lazy(a) * lazy(b) + lazy(b));
+    REQUIRE(a == expected);
+
+    big_int<16> c;
+    expr::assign(c, lazy(a) + lazy(b));
+    REQUIRE(c == expected + b);
+}
+
+TEST_CASE("Fused expressions are constexpr", "[expr]")
+{
+    constexpr big_int<16> a = 123'456'789;
+    constexpr big_int<16> b = -987'654'321;
+    constexpr big_int<16> c = 42;
+
+    constexpr big_int<16> fused = lazy(a) * lazy(b) + lazy(c) * lazy(c);
+    STATIC_REQUIRE(fused == a * b + c * c);
+    STATIC_REQUIRE(big_int<16>(lazy(a) + lazy(b) + lazy(c)) == a + b + c);
+}
+
+#endif  // ENABLE_BIG_INT_EXPR
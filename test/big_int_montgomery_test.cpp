@@ -0,0 +1,91 @@
+#include "catch2/catch_all.hpp"
+
+#include "big_int_montgomery.hpp"
+
+#include <stdexcept>
+
+#ifdef ENABLE_BIG_INT_UTIL
+
+struct prime_modulus
+{
+    static constexpr big_int<16> value = 1'000'000'007;
+};
+
+struct mersenne_modulus
+{
+    static constexpr big_int<8> value = (1LL << 61) - 1;
+};
+
+TEST_CASE("Montgomery inverse", "[montgomery]")
+{
+    for (u32 m = 1; m < 256; m += 2)
+    {
+        REQUIRE(u8(m * detail::montgomery_inverse(u8(m))) == 0xFF);
+    }
+}
+
+TEST_CASE("Montgomery multiplication matches the remainder", "[montgomery]")
+{
+    const unsigned long long mods[] = {3, 255, 257, 65'537, 1'000'000'007ULL,
+                                       (1ULL << 62) - 57};
+    for (const unsigned long long mod : mods)
+    {
+        const montgomery<16> context{big_int<16>(mod)};
+        for (unsigned long long a = 0; a < 5'000'000'000ULL;
+             a = a * 3 + 12'345)
+        {
+            for (unsigned long long b = 1; b < 5'000'000'000ULL;
+                 b = b * 7 + 3)
+            {
+                const big_int<16> expected =
+                    (big_int<16>(a) * big_int<16>(b)) % big_int<16>(mod);
+                const big_int<16> product =
+                    context.multiply(context.to_montgomery(big_int<16>(a)),
+                                     context.to_montgomery(big_int<16>(b)));
+                REQUIRE(context.from_montgomery(product) == expected);
+            }
+        }
+    }
+}
+
+TEST_CASE("Montgomery rejects a modulus that is not odd and positive",
+          "[montgomery]")
+{
+    REQUIRE_THROWS_AS(montgomery<16>(big_int<16>(0)), std::domain_error);
+    REQUIRE_THROWS_AS(montgomery<16>(big_int<16>(-7)), std::domain_error);
+    REQUIRE_THROWS_AS(montgomery<16>(big_int<16>(1'000)), std::domain_error);
+    REQUIRE_NOTHROW(montgomery<16>(big_int<16>(1'001)));
+}
+
+TEST_CASE("Montgomery pow matches pow_mod", "[montgomery]")
+{
+    const big_int<32> mod = pow(big_int<32>(10), big_int<32>(60)) + 7;
+    const montgomery<32> context{mod};
+    for (int base = -3; base < 40; base += 5)
+    {
+        const big_int<32> power = pow(big_int<32>(3), big_int<32>(base + 10));
+        REQUIRE(context.from_montgomery(context.pow(
+                    context.to_montgomery(big_int<32>(base)), power)) ==
+                pow_mod(big_int<32>(base), power, mod));
+    }
+}
+
+TEST_CASE("Compile time modulus", "[montgomery]")
+{
+    using mod_p = mod_int<16, prime_modulus>;
+    STATIC_REQUIRE((mod_p(big_int<16>(1'000'000'006)) * mod_p(big_int<16>(2)))
+                       .value() == big_int<16>(1'000'000'005));
+    STATIC_REQUIRE((mod_p(big_int<16>(-1)) + mod_p(big_int<16>(3))).value() ==
+                   big_int<16>(2));
+    STATIC_REQUIRE((mod_p(big_int<16>(1)) - mod_p(big_int<16>(3))).value() ==
+                   big_int<16>(1'000'000'005));
+
+    using mod_m = mod_int<8, mersenne_modulus>;
+    // Fermat's little theorem
+    REQUIRE(mod_m(big_int<8>(3)).pow(mersenne_modulus::value - 1) ==
+            mod_m(big_int<8>(1)));
+    REQUIRE(mod_m(big_int<8>(3)).pow(mersenne_modulus::value - 1).value() ==
+            big_int<8>(1));
+}
+
+#endif  // ENABLE_BIG_INT_UTIL
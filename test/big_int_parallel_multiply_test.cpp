@@ -0,0 +1,72 @@
+#include "catch2/catch_all.hpp"
+
+#include "big_int_parallel_multiply.hpp"
+
+#ifdef ENABLE_SI_PARALLEL
+
+template <size_t size>
+static big_int<size> random_number(u32 seed, size_t length = size)
+{
+    big_int<size> res;
+    u32 state = seed;
+    for (size_t i = 0; i < length; ++i)
+    {
+        state = state * 1'103'515'245U + 12'345U;
+        res.raw[i] = u8(state >> 16);
+    }
+    return res;
+}
+
+TEMPLATE_TEST_CASE_SIG("Parallel Karatsuba matches operator*",
+                       "[parallel_multiply]",
+                       ((size_t size), size),
+                       256,
+                       1000,
+                       2048)
+{
+    si::parallel::thread_pool pool(4);
+    si::parallel::inline_executor inline_exec;
+
+    const big_int<size> full_a = random_number<size>(7);
+    const big_int<size> full_b = random_number<size>(11);
+    const big_int<size> half_a = random_number<size>(13, size / 2);
+    const big_int<size> half_b = random_number<size>(17, size / 2 + 3);
+    const big_int<size> short_b = random_number<size>(19, 40);
+    const big_int<size> most_a = random_number<size>(31, size * 3 / 4);
+
+    const auto check = [&](const big_int<size>& a, const big_int<size>& b)
+    {
+        const big_int<size> expected = a * b;
+        // a low threshold splits over the threads on every level
+        REQUIRE(si::parallel::multiply(pool, a, b, 64) == expected);
+        REQUIRE(si::parallel::multiply(inline_exec, a, b) == expected);
+        REQUIRE(si::parallel::multiply(a, b) == expected);
+    };
+
+    check(full_a, full_b);
+    check(half_a, half_b);
+    check(full_a, half_b);
+    check(half_a, short_b);
+    // a product that fits between n and 2 * n limbs of the operands
+    check(most_a, most_a);
+    check(-half_a, half_b);
+    check(-full_a, -half_b);
+    check(full_a, big_int<size>());
+    check(big_int<size>(-1), big_int<size>(-1));
+}
+
+TEST_CASE("Parallel Karatsuba is deterministic", "[parallel_multiply]")
+{
+    si::parallel::thread_pool pool(4);
+    const big_int<4096> a = random_number<4096>(23, 2048);
+    const big_int<4096> b = random_number<4096>(29, 2048);
+
+    const big_int<4096> first = si::parallel::multiply(pool, a, b, 256);
+    for (int i = 0; i < 4; ++i)
+    {
+        REQUIRE(si::parallel::multiply(pool, a, b, 256) == first);
+    }
+    REQUIRE(first == a * b);
+}
+
+#endif  // ENABLE_SI_PARALLEL
@@ -0,0 +1,112 @@
+#include "catch2/catch_all.hpp"
+
+#include "big_int_simd.hpp"
+
+#ifdef ENABLE_BIG_INT_BATCH
+
+#include <vector>
+
+template <size_t size>
+static std::vector<big_int<size>> simd_sample_values(size_t count, int seed)
+{
+    std::vector<big_int<size>> values;
+    big_int<size> value = seed;
+    for (size_t i = 0; i < count; ++i)
+    {
+        value = value * big_int<size>(-999'983) + big_int<size>(seed);
+        switch (i % 5)
+        {
+            case 0:
+                values.push_back(big_int<size>(-1));
+                break;
+            case 1:
+                values.push_back(big_int<size>(int(i % 3)));
+                break;
+            default:
+                values.push_back(value);
+                break;
+        }
+    }
+    return values;
+}
+
+template <size_t size>
+static void check_kernels(simd::isa level)
+{
+    // not a multiple of the lanes, so the scalar tail runs too
+    const size_t count = 333;
+    const auto lhs = simd_sample_values<size>(count, 3);
+    auto rhs = simd_sample_values<size>(count, -7);
+    for (size_t i = 0; i < count; i += 4)
+    {
+        rhs[i] = lhs[i];
+    }
+
+    const big_int_array<size> a(lhs.data(), count);
+    const big_int_array<size> b(rhs.data(), count);
+    big_int_array<size> out(count);
+    std::vector<u8> flags(count);
+
+    const auto kernels = detail::kernels_for<size>(level);
+
+    kernels.add(a, b, out, 0, count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        REQUIRE(out.get(i) == lhs[i] + rhs[i]);
+    }
+
+    kernels.sub(a, b, out, 0, count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        REQUIRE(out.get(i) == lhs[i] - rhs[i]);
+    }
+
+    kernels.equal(a, b, flags.data(), 0, count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        REQUIRE(flags[i] == u8(lhs[i] == rhs[i]));
+    }
+
+    kernels.less(a, b, flags.data(), 0, count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        REQUIRE(flags[i] == u8(lhs[i] < rhs[i]));
+    }
+}
+
+TEST_CASE("Every available instruction set matches the scalar operators",
+          "[simd]")
+{
+    const simd::isa levels[] = {simd::isa::scalar, simd::isa::avx2,
+                                simd::isa::avx512};
+    for (const simd::isa level : levels)
+    {
+        if (level > simd::active_isa())
+        {
+            continue;
+        }
+        check_kernels<4>(level);
+        check_kernels<16>(level);
+        check_kernels<33>(level);
+    }
+}
+
+TEST_CASE("Dispatched kernels", "[simd]")
+{
+    const auto lhs = simd_sample_values<32>(1'000, 11);
+    const auto rhs = simd_sample_values<32>(1'000, 13);
+    const big_int_array<32> a(lhs.data(), lhs.size());
+    const big_int_array<32> b(rhs.data(), rhs.size());
+    big_int_array<32> out(lhs.size());
+    std::vector<u8> flags(lhs.size());
+
+    simd::add(a, b, out);
+    simd::less(a, b, flags.data());
+    for (size_t i = 0; i < lhs.size(); ++i)
+    {
+        REQUIRE(out.get(i) == lhs[i] + rhs[i]);
+        REQUIRE(flags[i] == u8(lhs[i] < rhs[i]));
+    }
+}
+
+#endif  // ENABLE_BIG_INT_BATCH
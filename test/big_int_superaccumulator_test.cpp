@@ -0,0 +1,112 @@
+#include "catch2/catch_all.hpp"
+
+#include "big_int_superaccumulator.hpp"
+#include "strong_decorators.hpp"
+#include "strong_type.hpp"
+
+#ifdef ENABLE_BIG_INT_UTIL
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+using energy = strong_type<superaccumulator, struct energy_tag, addable>;
+
+static double exact_sum(const std::vector<double>& values)
+{
+    superaccumulator sum;
+    for (const double value : values)
+    {
+        sum += value;
+    }
+    return sum.to_double();
+}
+
+TEST_CASE("Superaccumulator sums exactly", "[superaccumulator]")
+{
+    REQUIRE(exact_sum({}) == 0.0);
+    REQUIRE(exact_sum({1e308, 1.0, -1e308}) == 1.0);
+    REQUIRE(exact_sum({0.1, 0.2, -0.3}) == 0x1p-55);
+    REQUIRE(exact_sum({3.5, -7.25}) == -3.75);
+
+    const double min_subnormal = std::numeric_limits<double>::denorm_min();
+    REQUIRE(exact_sum({min_subnormal, min_subnormal}) == 2 * min_subnormal);
+    REQUIRE(exact_sum({std::numeric_limits<double>::min(), -min_subnormal}) ==
+            std::nextafter(std::numeric_limits<double>::min(), 0.0));
+}
+
+TEST_CASE("Superaccumulator rounds to nearest even", "[superaccumulator]")
+{
+    // ties go to the even mantissa
+    REQUIRE(exact_sum({1.0, 0x1p-53}) == 1.0);
+    REQUIRE(exact_sum({1.0 + 0x1p-52, 0x1p-53}) == 1.0 + 0x1p-51);
+    // anything below the tie breaks it
+    REQUIRE(exact_sum({1.0, 0x1p-53, 0x1p-1074}) == 1.0 + 0x1p-52);
+    REQUIRE(exact_sum({-1.0, -0x1p-53, -0x1p-1074}) == -1.0 - 0x1p-52);
+    // rounding up may carry into the exponent
+    REQUIRE(exact_sum({2.0 - 0x1p-52, 0x1p-53}) == 2.0);
+
+    const double max = std::numeric_limits<double>::max();
+    REQUIRE(exact_sum({max, max, -max}) == max);
+    REQUIRE(std::isinf(exact_sum({max, max})));
+    REQUIRE(std::isnan(exact_sum({1.0, HUGE_VAL, -HUGE_VAL})));
+}
+
+TEST_CASE("Superaccumulator does not depend on the order", "[superaccumulator]")
+{
+    std::vector<double> values;
+    u32 state = 7;
+    for (int i = 0; i < 4'000; ++i)
+    {
+        state = state * 1'103'515'245U + 12'345U;
+        const int exponent = int(state >> 16) % 600 - 300;
+        const double mantissa = double(state % 100'000) / 1000.0 - 50.0;
+        values.push_back(std::ldexp(mantissa, exponent));
+    }
+
+    superaccumulator forward;
+    for (const double value : values)
+    {
+        forward += value;
+    }
+
+    // partial sums of uneven chunks merged in reverse
+    std::vector<superaccumulator> partials;
+    for (size_t first = 0; first < values.size(); first += 333)
+    {
+        superaccumulator partial;
+        for (size_t i = first; i < std::min(first + 333, values.size()); ++i)
+        {
+            partial += values[i];
+        }
+        partials.push_back(partial);
+    }
+    superaccumulator merged;
+    for (auto it = partials.rbegin(); it != partials.rend(); ++it)
+    {
+        merged += *it;
+    }
+
+    std::sort(values.begin(), values.end());
+    REQUIRE(merged == forward);
+    REQUIRE(merged.to_double() == forward.to_double());
+    REQUIRE(exact_sum(values) == forward.to_double());
+
+    for (const double value : values)
+    {
+        forward += -value;
+    }
+    REQUIRE(forward.to_double() == 0.0);
+    REQUIRE(forward.fixed() == superaccumulator::fixed_t(0));
+}
+
+TEST_CASE("Superaccumulator keeps the unit", "[superaccumulator]")
+{
+    const energy a(superaccumulator(1e20));
+    const energy b(superaccumulator(-1e20));
+    const energy c(superaccumulator(0.5));
+    REQUIRE((a + c + b).value.to_double() == 0.5);
+}
+
+#endif  // ENABLE_BIG_INT_UTIL
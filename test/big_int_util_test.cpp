@@ -0,0 +1,253 @@
+#include "catch2/catch_all.hpp"
+
+#include "big_int_util.hpp"
+
+#include <numeric>
+#include <stdexcept>
+
+#ifdef ENABLE_BIG_INT_UTIL
+
+TEST_CASE("exp2 sets a single bit", "[util]")
+{
+    STATIC_REQUIRE(exp2(big_int<8>(10)) == big_int<8>(1024));
+    REQUIRE(exp2(big_int<8>(62)) == big_int<8>(1LL << 62));
+    REQUIRE(exp2(big_int<8>(63)) ==
+            big_int<8>(std::numeric_limits<long long>::min()));
+    REQUIRE(exp2(big_int<8>(64)) == big_int<8>(0));
+    REQUIRE(exp2(big_int<8>(-1)) == big_int<8>(0));
+}
+
+TEST_CASE("pow matches repeated multiplication", "[util]")
+{
+    STATIC_REQUIRE(pow(big_int<8>(10), big_int<8>(18)) ==
+                   big_int<8>(1'000'000'000'000'000'000LL));
+
+    for (long long base = -5; base <= 5; ++base)
+    {
+        big_int<64> expected = 1;
+        for (int power = 0; power < 300; ++power)
+        {
+            REQUIRE(pow(big_int<64>(base), big_int<64>(power)) == expected);
+            expected *= big_int<64>(base);
+        }
+    }
+
+    REQUIRE(pow(big_int<8>(2), big_int<8>(-3)) == big_int<8>(0));
+    REQUIRE(pow(big_int<8>(-1), big_int<8>(-3)) == big_int<8>(-1));
+    REQUIRE(pow(big_int<8>(1), big_int<8>(-3)) == big_int<8>(1));
+}
+
+TEST_CASE("pow_mod matches the built-in integers", "[util]")
+{
+    const unsigned long long mods[] = {1, 2, 97, 65'537, 1'000'000'007ULL};
+    for (const unsigned long long mod : mods)
+    {
+        for (long long base = -20; base <= 20; base += 3)
+        {
+            unsigned long long expected = 1 % mod;
+            const unsigned long long reduced = static_cast<unsigned long long>(
+                (base % static_cast<long long>(mod) +
+                 static_cast<long long>(mod)) %
+                static_cast<long long>(mod));
+            for (long long power = 0; power < 200; ++power)
+            {
+                REQUIRE(pow_mod(big_int<16>(base), big_int<16>(power),
+                                big_int<16>(mod)) == big_int<16>(expected));
+                expected = expected * reduced % mod;
+            }
+        }
+    }
+
+    // Fermat's little theorem for the prime 2^61 - 1
+    const big_int<8> mersenne = (1LL << 61) - 1;
+    REQUIRE(pow_mod(big_int<8>(3), mersenne - big_int<8>(1), mersenne) ==
+            big_int<8>(1));
+
+    REQUIRE_THROWS_AS(pow_mod(big_int<8>(3), big_int<8>(2), big_int<8>(0)),
+                      std::domain_error);
+    REQUIRE_THROWS_AS(pow_mod(big_int<8>(3), big_int<8>(2), big_int<8>(-5)),
+                      std::domain_error);
+}
+
+// The reference the Newton iteration is checked against
+// Works in double width, so the powers of the midpoint cannot wrap
+template <size_t size>
+static big_int<size> bisection_root(const big_int<size>& number, size_t k)
+{
+    using wide_t = big_int<size * 2>;
+    const wide_t wide_number = wide_t(number);
+
+    wide_t low = 0;
+    wide_t high = 0;
+    high.set_bit(number.bit_width() / k + 1);
+    while (wide_t(1) < high - low)
+    {
+        const wide_t mid = low + (high - low) / wide_t(2);
+        wide_t power = 1;
+        for (size_t i = 0; i < k; ++i)
+        {
+            power *= mid;
+        }
+        (wide_number < power ? high : low) = mid;
+    }
+    return big_int<size>(low);
+}
+
+TEST_CASE("isqrt and iroot agree with bisection", "[util]")
+{
+    STATIC_REQUIRE(isqrt(big_int<8>(1'000'000)) == big_int<8>(1'000));
+    STATIC_REQUIRE(iroot(big_int<8>(-1'000'000), 3) == big_int<8>(-100));
+
+    big_int<32> number = 0;
+    for (int i = 0; i < 200; ++i)
+    {
+        REQUIRE(isqrt(number) == bisection_root(number, 2));
+        for (size_t k = 1; k < 7; ++k)
+        {
+            REQUIRE(iroot(number, k) == bisection_root(number, k));
+        }
+        number = number * big_int<32>(3) + big_int<32>(i % 2);
+        if (number.bit_width() > 250)
+        {
+            number = number / big_int<32>(1'000'003);
+        }
+    }
+
+    const big_int<32> max = (big_int<32>(1) << big_int<32>(255)) - 1;
+    REQUIRE(isqrt(max) == bisection_root(max, 2));
+    REQUIRE(iroot(max, 5) == bisection_root(max, 5));
+
+    const big_int<32> square = pow(big_int<32>(10), big_int<32>(70));
+    REQUIRE(isqrt(square) == pow(big_int<32>(10), big_int<32>(35)));
+    REQUIRE(isqrt(square - 1) == pow(big_int<32>(10), big_int<32>(35)) - 1);
+}
+
+TEST_CASE("Integer logarithms", "[util]")
+{
+    STATIC_REQUIRE(log2(big_int<8>(1'024)) == big_int<8>(10));
+    STATIC_REQUIRE(log10(big_int<8>(999)) == big_int<8>(2));
+    STATIC_REQUIRE(log(big_int<8>(3), big_int<8>(81)) == big_int<8>(4));
+
+    REQUIRE(log2(big_int<8>(0)) == big_int<8>(-1));
+    REQUIRE(log10(big_int<8>(-5)) == big_int<8>(-1));
+    REQUIRE(log(big_int<8>(1), big_int<8>(5)) == big_int<8>(-1));
+
+    for (long long power = 1, exponent = 0; exponent < 19;
+         power *= 10, ++exponent)
+    {
+        REQUIRE(log10(big_int<8>(power)) == big_int<8>(exponent));
+        REQUIRE(log10(big_int<8>(power - 1)) == big_int<8>(exponent - 1));
+        REQUIRE(log10(big_int<8>(power + 1)) == big_int<8>(exponent));
+        REQUIRE(log(big_int<8>(10), big_int<8>(power)) ==
+                big_int<8>(exponent));
+        REQUIRE(log(big_int<8>(10), big_int<8>(power - 1)) ==
+                big_int<8>(exponent - 1));
+    }
+
+    // past the size of the powers of ten table
+    using huge_t = big_int<256>;
+    for (int exponent = 1; exponent < 600; exponent += 37)
+    {
+        const huge_t power = pow(huge_t(10), huge_t(exponent));
+        REQUIRE(log10(power) == huge_t(exponent));
+        REQUIRE(log10(power - huge_t(1)) == huge_t(exponent - 1));
+        REQUIRE(log(huge_t(10), power) == huge_t(exponent));
+        REQUIRE(log(huge_t(7), pow(huge_t(7), huge_t(exponent))) ==
+                huge_t(exponent));
+        REQUIRE(log2(power) == huge_t(int(power.bit_width()) - 1));
+    }
+}
+
+TEST_CASE("Factorial", "[util]")
+{
+    STATIC_REQUIRE(fact(big_int<8>(20)) ==
+                   big_int<8>(2'432'902'008'176'640'000LL));
+    REQUIRE(fact(big_int<8>(0)) == big_int<8>(1));
+    REQUIRE(detail::factorials<8>.size() == 21);
+
+    // past the table the result wraps like repeated multiplication
+    big_int<8> wrapped = 1;
+    big_int<64> expected = 1;
+    big_int<512> wide_expected = 1;
+    for (int n = 1; n < 200; ++n)
+    {
+        wrapped *= big_int<8>(n);
+        expected *= big_int<64>(n);
+        wide_expected *= big_int<512>(n);
+        REQUIRE(fact(big_int<8>(n)) == wrapped);
+        REQUIRE(fact(big_int<64>(n)) == expected);
+        REQUIRE(fact(big_int<512>(n)) == wide_expected);
+    }
+    REQUIRE(fact(big_int<8>(1'000)) == big_int<8>(0));
+}
+
+TEST_CASE("Fibonacci", "[util]")
+{
+    STATIC_REQUIRE(fib(big_int<8>(90)) ==
+                   big_int<8>(2'880'067'194'370'816'120LL));
+    REQUIRE(fib(big_int<8>(-8)) == big_int<8>(-21));
+    REQUIRE(fib(big_int<8>(-7)) == big_int<8>(13));
+
+    big_int<8> previous = 0;
+    big_int<8> current = 1;
+    big_int<64> wide_previous = 0;
+    big_int<64> wide_current = 1;
+    for (int n = 1; n < 1'000; ++n)
+    {
+        REQUIRE(fib(big_int<8>(n)) == current);
+        REQUIRE(fib(big_int<64>(n)) == wide_current);
+
+        const big_int<8> next = previous + current;
+        previous = current;
+        current = next;
+        const big_int<64> wide_next = wide_previous + wide_current;
+        wide_previous = wide_current;
+        wide_current = wide_next;
+    }
+}
+
+TEST_CASE("gcd and lcm match the built-in integers", "[util]")
+{
+    STATIC_REQUIRE(gcd(big_int<8>(12), big_int<8>(18)) == big_int<8>(6));
+    STATIC_REQUIRE(lcm(big_int<8>(4), big_int<8>(6)) == big_int<8>(12));
+    REQUIRE(gcd(big_int<8>(0), big_int<8>(0)) == big_int<8>(0));
+    REQUIRE(gcd(big_int<8>(0), big_int<8>(-5)) == big_int<8>(5));
+    REQUIRE(lcm(big_int<8>(0), big_int<8>(7)) == big_int<8>(0));
+
+    for (long long a = -60; a <= 60; ++a)
+    {
+        for (long long b = -60; b <= 60; ++b)
+        {
+            REQUIRE(gcd(big_int<8>(a), big_int<8>(b)) ==
+                    big_int<8>(std::gcd(a, b)));
+            REQUIRE(lcm(big_int<8>(a), big_int<8>(b)) ==
+                    big_int<8>(std::lcm(a, b)));
+        }
+    }
+
+    // large common powers of two and odd factors
+    const big_int<64> two_pow = exp2(big_int<64>(300));
+    const big_int<64> odd = pow(big_int<64>(3), big_int<64>(100));
+    const big_int<64> a = two_pow * odd * big_int<64>(7);
+    const big_int<64> b = two_pow * odd * big_int<64>(40);
+    REQUIRE(gcd(a, b) == two_pow * odd);
+    REQUIRE(gcd(-a, b) == two_pow * odd);
+    REQUIRE(lcm(two_pow, odd) == two_pow * odd);
+}
+
+TEST_CASE("fma matches the multiplication and the addition", "[util]")
+{
+    STATIC_REQUIRE(fma(big_int<8>(-7), big_int<8>(6), big_int<8>(50)) ==
+                   big_int<8>(8));
+
+    const big_int<64> odd = pow(big_int<64>(3), big_int<64>(150));
+    const big_int<64> even = exp2(big_int<64>(200)) - big_int<64>(12'345);
+    for (long long c = -1'000; c <= 1'000; c += 37)
+    {
+        REQUIRE(fma(odd, even, big_int<64>(c)) == odd * even + c);
+        REQUIRE(fma(-odd, even, big_int<64>(c)) == -odd * even + c);
+        REQUIRE(fma(big_int<64>(c), odd, odd) == big_int<64>(c) * odd + odd);
+    }
+}
+
+#endif  // ENABLE_BIG_INT_UTIL
@@ -0,0 +1,109 @@
+#include "catch2/catch_all.hpp"
+
+#include "big_rational.hpp"
+#include "strong_decorators.hpp"
+#include "strong_type.hpp"
+
+#ifdef ENABLE_BIG_INT_UTIL
+
+#include <limits>
+#include <stdexcept>
+
+using rational = big_rational<16>;
+
+TEST_CASE("Rational arithmetic", "[rational]")
+{
+    const rational half(big_int<16>(1), big_int<16>(2));
+    const rational third(big_int<16>(-2), big_int<16>(-6));
+
+    REQUIRE(half + third == rational(big_int<16>(5), big_int<16>(6)));
+    REQUIRE(half - third == rational(big_int<16>(1), big_int<16>(6)));
+    REQUIRE(half * third == rational(big_int<16>(1), big_int<16>(6)));
+    REQUIRE(half / third == rational(big_int<16>(3), big_int<16>(2)));
+    REQUIRE(-half == rational(big_int<16>(1), big_int<16>(-2)));
+    REQUIRE(half + half == 1);
+    REQUIRE(half - half == 0);
+
+    REQUIRE(third < half);
+    REQUIRE(-half < third);
+    REQUIRE(half <= half);
+    REQUIRE(half > -half);
+    REQUIRE(half >= third);
+    REQUIRE(half != third);
+
+    REQUIRE((half * 7).truncate() == 3);
+    REQUIRE((-half * 7).truncate() == -3);
+
+    rational value = third;
+    value /= value;
+    REQUIRE(value == 1);
+
+    REQUIRE_THROWS_AS(rational(big_int<16>(1), big_int<16>(0)),
+                      std::domain_error);
+    REQUIRE_THROWS_AS(half / rational(), std::domain_error);
+}
+
+TEST_CASE("Rationals are reduced lazily", "[rational]")
+{
+    rational value(big_int<16>(6), big_int<16>(4));
+    REQUIRE(!value.is_normalized());
+    REQUIRE(value == rational(big_int<16>(3), big_int<16>(2)));
+    REQUIRE(!value.is_normalized());
+
+    // reading reduces a copy, the fraction itself only by normalize()
+    REQUIRE(value.numerator() == 3);
+    REQUIRE(value.denominator() == 2);
+    REQUIRE(!value.is_normalized());
+    REQUIRE(value.normalized().is_normalized());
+    value.normalize();
+    REQUIRE(value.is_normalized());
+
+    // 2^k / 3^k stays small enough for a few rounds without a gcd
+    const rational factor(big_int<16>(4), big_int<16>(2));
+    for (int i = 0; i < 3; ++i)
+    {
+        value *= factor;
+        REQUIRE(!value.is_normalized());
+    }
+    REQUIRE(value == 12);
+
+    // many more rounds only fit because of the reductions in between
+    rational product = 1;
+    for (int i = 0; i < 100; ++i)
+    {
+        product *= factor;
+        product /= factor;
+    }
+    REQUIRE(product == 1);
+    REQUIRE(product.numerator() == 1);
+    REQUIRE(product.denominator() == 1);
+}
+
+TEST_CASE("Rationals work with strong types", "[rational]")
+{
+    using ratio_t = strong_type<rational,
+                                struct rational_ratio_tag,
+                                addable,
+                                subtractable,
+                                comparable,
+                                scalable>;
+
+    const ratio_t a(rational(big_int<16>(1), big_int<16>(3)));
+    const ratio_t b(rational(big_int<16>(1), big_int<16>(6)));
+    REQUIRE((a + b).value == rational(big_int<16>(1), big_int<16>(2)));
+    REQUIRE((a - b) == b);
+    REQUIRE((a * 3).value == 1);
+    REQUIRE((a / 2) == b);
+}
+
+#ifdef ENABLE_BIG_INT_STD_INTEGRATION
+TEST_CASE("Rationals print in lowest terms", "[rational]")
+{
+    REQUIRE(to_string(rational(big_int<16>(6), big_int<16>(-4))) == "-3/2");
+    REQUIRE(to_string(rational(big_int<16>(8), big_int<16>(4))) == "2");
+    REQUIRE(to_string(big_int<8>(std::numeric_limits<long long>::min())) ==
+            "-9223372036854775808");
+}
+#endif  // ENABLE_BIG_INT_STD_INTEGRATION
+
+#endif  // ENABLE_BIG_INT_UTIL
@@ -0,0 +1,132 @@
+#include "catch2/catch_all.hpp"
+
+#include "dyn_quantity.hpp"
+#include "strong_decorators.hpp"
+#include "strong_dimensions.hpp"
+#include "strong_type.hpp"
+#include "strong_units.hpp"
+
+#include <array>
+#include <ratio>
+#include <stdexcept>
+
+using quantity = dyn_quantity<16>;
+
+using meter = strong_type<big_int<16>, dimensions::length, addable>;
+using kilometer =
+    strong_type<big_int<16>, prefixed_t<std::kilo, dimensions::length>>;
+using second = strong_type<big_int<16>, dimensions::time>;
+using meter_per_second = strong_type<big_int<16>, dimensions::velocity>;
+
+TEST_CASE("Packed dimensions", "[dyn_quantity]")
+{
+    STATIC_REQUIRE(packed_dimension_v<dimensions::dimensionless> == 0);
+    STATIC_REQUIRE(packed_dimension_v<dimensions::energy> ==
+                   pack_dimension({2, 1, -2, 0, 0, 0, 0}));
+    STATIC_REQUIRE(dimension_exponent(packed_dimension_v<dimensions::energy>,
+                                      2) == -2);
+    STATIC_REQUIRE(
+        multiply_dimensions(packed_dimension_v<dimensions::force>,
+                            packed_dimension_v<dimensions::length>) ==
+        packed_dimension_v<dimensions::energy>);
+    STATIC_REQUIRE(
+        divide_dimensions(packed_dimension_v<dimensions::length>,
+                          packed_dimension_v<dimensions::time>) ==
+        packed_dimension_v<dimensions::velocity>);
+
+    // every pair of exponents in the range adds like the integers
+    for (int a = -60; a <= 60; ++a)
+    {
+        for (int b = -60; b <= 60; ++b)
+        {
+            const packed_dimension x = pack_dimension({a, b, -a, 0, a, b, 1});
+            const packed_dimension y = pack_dimension({b, a, b, -b, 0, 1, a});
+            const packed_dimension product = multiply_dimensions(x, y);
+            const packed_dimension quotient = divide_dimensions(x, y);
+            REQUIRE(product == pack_dimension({a + b, a + b, b - a, -b, a,
+                                               b + 1, a + 1}));
+            REQUIRE(quotient == pack_dimension({a - b, b - a, -a - b, b, a,
+                                                b - 1, 1 - a}));
+        }
+    }
+
+    // the overflow is found for every pair of exponents, in any base unit
+    for (int a = -128; a <= 127; ++a)
+    {
+        for (int b = -128; b <= 127; ++b)
+        {
+            const size_t base_unit = size_t(a + b + 256) % 7;
+            std::array<int, 7> x_exponents = {1, -1, 0, 2, -2, 3, 0};
+            std::array<int, 7> y_exponents = {-1, 1, 0, -2, 2, -3, 0};
+            x_exponents[base_unit] = a;
+            y_exponents[base_unit] = b;
+            const packed_dimension x = pack_dimension(x_exponents);
+            const packed_dimension y = pack_dimension(y_exponents);
+            const bool sum_fits = a + b >= -128 && a + b <= 127;
+            const bool difference_fits = a - b >= -128 && a - b <= 127;
+            REQUIRE((product_overflow(x, y, multiply_dimensions(x, y)) == 0) ==
+                    sum_fits);
+            REQUIRE((quotient_overflow(x, y, divide_dimensions(x, y)) == 0) ==
+                    difference_fits);
+        }
+    }
+}
+
+TEST_CASE("Run-time quantities check their dimensions", "[dyn_quantity]")
+{
+    // as if the units came from a file header
+    const packed_dimension length = pack_dimension({1, 0, 0, 0, 0, 0, 0});
+    const packed_dimension time = pack_dimension({0, 0, 1, 0, 0, 0, 0});
+
+    const quantity distance(big_int<16>(3000), length);
+    const quantity duration(big_int<16>(60), time);
+
+    REQUIRE((distance + distance).value() == 6000);
+    REQUIRE((distance - distance).value() == 0);
+    REQUIRE_THROWS_AS(distance + duration, std::domain_error);
+    REQUIRE_THROWS_AS(distance < duration, std::domain_error);
+    REQUIRE(distance != duration);
+
+    const quantity speed = distance / duration;
+    REQUIRE(speed.dimension() == packed_dimension_v<dimensions::velocity>);
+    REQUIRE(speed.value() == 50);
+    REQUIRE((speed * duration) == distance);
+
+    REQUIRE(distance.as<meter>().value == 3000);
+    REQUIRE(distance.as<kilometer>().value == 3);
+    REQUIRE(speed.as<meter_per_second>().value == 50);
+    REQUIRE_THROWS_AS(distance.as<second>(), std::domain_error);
+}
+
+TEST_CASE("Run-time quantities reject exponents out of range",
+          "[dyn_quantity]")
+{
+    const packed_dimension length = pack_dimension({1, 0, 0, 0, 0, 0, 0});
+    const quantity meter_quantity(big_int<16>(2), length);
+
+    quantity high(big_int<16>(3), pack_dimension({127, 0, 0, 0, 0, 0, 0}));
+    REQUIRE_THROWS_AS(high * meter_quantity, std::domain_error);
+    REQUIRE_THROWS_AS(high *= meter_quantity, std::domain_error);
+    // unchanged by the failed product
+    REQUIRE(high.value() == 3);
+    REQUIRE(dimension_exponent(high.dimension(), 0) == 127);
+    REQUIRE(dimension_exponent((high / meter_quantity).dimension(), 0) ==
+            126);
+
+    quantity low(big_int<16>(3), pack_dimension({-128, 0, 0, 0, 0, 0, 0}));
+    REQUIRE_THROWS_AS(low / meter_quantity, std::domain_error);
+    REQUIRE_THROWS_AS(low /= meter_quantity, std::domain_error);
+    REQUIRE(low.value() == 3);
+    REQUIRE(dimension_exponent(low.dimension(), 0) == -128);
+    REQUIRE(dimension_exponent((low * meter_quantity).dimension(), 0) ==
+            -127);
+}
+
+TEST_CASE("Typed quantities convert to run-time ones", "[dyn_quantity]")
+{
+    const quantity from_meters(meter(big_int<16>(5)));
+    const quantity from_kilometers(kilometer(big_int<16>(2)));
+    REQUIRE(from_meters.dimension() == packed_dimension_v<dimensions::length>);
+    REQUIRE(from_kilometers.value() == 2000);
+    REQUIRE((from_meters + from_kilometers).as<meter>().value == 2005);
+}
@@ -0,0 +1,102 @@
+#include "catch2/catch_all.hpp"
+
+#include "fixed_decimal.hpp"
+#include "strong_decorators.hpp"
+#include "strong_type.hpp"
+
+#ifdef ENABLE_BIG_INT_UTIL
+
+#include <type_traits>
+
+using milli = fixed_decimal<16, 3>;
+using micro = fixed_decimal<16, 6>;
+
+TEST_CASE("Fixed decimal arithmetic", "[fixed_decimal]")
+{
+    STATIC_REQUIRE(milli(2).units() == 2000);
+    STATIC_REQUIRE((milli(1) + milli::from_units(500)).units() == 1500);
+
+    const milli a = milli::from_units(1'250);
+    const milli b = milli::from_units(-3'500);
+    REQUIRE((a + b).units() == -2'250);
+    REQUIRE((a - b).units() == 4'750);
+    REQUIRE((-a).units() == -1'250);
+    REQUIRE(b < a);
+    REQUIRE(a == milli::from_units(1'250));
+
+    // 1.25 * -3.5 = -4.375 with the scales added
+    const micro product = a * b;
+    REQUIRE(product.units() == -4'375'000);
+    STATIC_REQUIRE(std::is_same<decltype(a * milli()), micro>::value);
+
+    milli scaled = a;
+    scaled *= 4;
+    REQUIRE(scaled == milli(5));
+    scaled /= 3;
+    REQUIRE(scaled.units() == 1'666);
+    scaled *= big_int<16>(-2);
+    scaled /= big_int<16>(5);
+    REQUIRE(scaled.units() == -666);
+}
+
+TEST_CASE("Rescaling keeps the value", "[fixed_decimal]")
+{
+    const milli a = milli::from_units(123'456);
+    REQUIRE(a.rescale<6>().units() == 123'456'000);
+    REQUIRE(a.rescale<3>() == a);
+    REQUIRE(a.rescale<2>().units() == 12'345);
+    REQUIRE(a.rescale<1>().units() == 1'234);
+    REQUIRE(a.rescale<0>().units() == 123);
+    REQUIRE(a.whole() == 123);
+    REQUIRE((-a).whole() == -123);
+
+    // the steps of the division truncate like a single one
+    for (long long units = -20'000; units <= 20'000; units += 7)
+    {
+        const micro value = micro::from_units(big_int<16>(units));
+        REQUIRE(value.rescale<1>().units() == units / 100'000);
+        REQUIRE(value.rescale<2>().units() == units / 10'000);
+    }
+
+    // more digits than one native power of ten holds
+    using fine = fixed_decimal<32, 40>;
+    const big_int<32> units = -detail::power_of_ten<32>(45) / 7;
+    const fine value = fine::from_units(units);
+    REQUIRE(value.rescale<0>().units() ==
+            units / detail::power_of_ten<32>(40));
+    REQUIRE(value.rescale<23>().units() ==
+            units / detail::power_of_ten<32>(17));
+    REQUIRE(value.rescale<24>().units() ==
+            units / detail::power_of_ten<32>(16));
+}
+
+TEST_CASE("Fixed decimals in strong types", "[fixed_decimal]")
+{
+    using energy_t = strong_type<fixed_decimal<16, 3>,
+                                 struct fixed_energy_tag,
+                                 addable,
+                                 compound_addable,
+                                 comparable,
+                                 scalable>;
+
+    energy_t total(fixed_decimal<16, 3>(0));
+    for (int i = 0; i < 1'000; ++i)
+    {
+        total += energy_t(fixed_decimal<16, 3>::from_units(1));
+    }
+    REQUIRE(total == energy_t(fixed_decimal<16, 3>(1)));
+    REQUIRE((total + total).value.units() == 2'000);
+    REQUIRE((total * 3).value == fixed_decimal<16, 3>(3));
+}
+
+#ifdef ENABLE_BIG_INT_STD_INTEGRATION
+TEST_CASE("Fixed decimals print all of the digits", "[fixed_decimal]")
+{
+    REQUIRE(to_string(milli::from_units(1'500)) == "1.500");
+    REQUIRE(to_string(milli::from_units(-7)) == "-0.007");
+    REQUIRE(to_string(milli()) == "0.000");
+    REQUIRE(to_string(fixed_decimal<16, 0>(42)) == "42");
+}
+#endif  // ENABLE_BIG_INT_STD_INTEGRATION
+
+#endif  // ENABLE_BIG_INT_UTIL
@@ -0,0 +1,169 @@
+#include "catch2/catch_all.hpp"
+
+#include "si_executor.hpp"
+#include "si_parallel.hpp"
+
+#ifdef ENABLE_SI_PARALLEL
+
+#include <algorithm>
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+// Counts the calls and runs them on the calling thread
+class counting_executor final : public si::parallel::executor
+{
+public:
+    BIG_INT_NODISCARD size_t concurrency() const noexcept override
+    {
+        return 2;
+    }
+
+    void bulk_execute(
+        size_t count,
+        size_t grain,
+        const std::function<void(size_t, size_t)>& body) override
+    {
+        ++calls;
+        inner.bulk_execute(count, grain, body);
+    }
+
+    size_t calls = 0;
+
+private:
+    si::parallel::inline_executor inner;
+};
+
+TEST_CASE("Work-stealing deque", "[executor]")
+{
+    std::vector<int> items(20'000);
+    {
+        si::parallel::detail::work_stealing_deque<int*> deque(2);
+        for (int& item : items)
+        {
+            deque.push(&item);
+        }
+        // the owner takes the newest, the thieves the oldest
+        REQUIRE(deque.pop() == &items.back());
+        REQUIRE(deque.steal() == &items.front());
+    }
+
+    // every item is taken exactly once while the owner pushes and pops
+    si::parallel::detail::work_stealing_deque<int*> deque(2);
+    std::vector<std::atomic<int>> taken(items.size());
+    const auto take = [&](int* item)
+    { ++taken[size_t(item - items.data())]; };
+
+    std::atomic<bool> pushing{true};
+    std::vector<std::thread> thieves;
+    for (int i = 0; i < 3; ++i)
+    {
+        thieves.emplace_back(
+            [&]
+            {
+                while (pushing || !deque.empty())
+                {
+                    if (int* stolen = deque.steal())
+                    {
+                        take(stolen);
+                    }
+                }
+            });
+    }
+
+    for (size_t i = 0; i < items.size(); ++i)
+    {
+        deque.push(&items[i]);
+        if (i % 3 == 0)
+        {
+            if (int* own = deque.pop())
+            {
+                take(own);
+            }
+        }
+    }
+    while (!deque.empty())
+    {
+        if (int* own = deque.pop())
+        {
+            take(own);
+        }
+    }
+    pushing = false;
+    for (std::thread& thief : thieves)
+    {
+        thief.join();
+    }
+
+    REQUIRE(std::all_of(taken.begin(), taken.end(),
+                        [](const std::atomic<int>& count)
+                        { return count == 1; }));
+}
+
+TEST_CASE("Parallel for visits every index once", "[executor]")
+{
+    for (const size_t threads : {size_t(1), size_t(2), size_t(5)})
+    {
+        si::parallel::thread_pool pool(threads);
+        for (const size_t grain :
+             {size_t(1), size_t(7), size_t(1'000), size_t(50'000)})
+        {
+            std::vector<std::atomic<int>> visits(10'007);
+            si::parallel::parallel_for(pool, 3, visits.size(), grain,
+                                       [&visits](size_t i) { ++visits[i]; });
+
+            REQUIRE(visits[0] == 0);
+            REQUIRE(visits[2] == 0);
+            REQUIRE(std::all_of(visits.begin() + 3, visits.end(),
+                                [](const std::atomic<int>& count)
+                                { return count == 1; }));
+        }
+    }
+}
+
+TEST_CASE("Nested parallel loops run on the same pool", "[executor]")
+{
+    si::parallel::thread_pool pool(4);
+    std::vector<std::atomic<int>> visits(100 * 100);
+    si::parallel::parallel_for(
+        pool, 0, 100, 1,
+        [&](size_t outer)
+        {
+            si::parallel::parallel_for(pool, 0, 100, 3,
+                                       [&](size_t inner)
+                                       { ++visits[outer * 100 + inner]; });
+        });
+    REQUIRE(std::all_of(visits.begin(), visits.end(),
+                        [](const std::atomic<int>& count)
+                        { return count == 1; }));
+
+    REQUIRE_THROWS_AS(si::parallel::parallel_for(
+                          pool, 0, 1'000, 10,
+                          [](size_t i)
+                          {
+                              if (i == 500)
+                              {
+                                  throw std::runtime_error("failed");
+                              }
+                          }),
+                      std::runtime_error);
+}
+
+TEST_CASE("Injected executor", "[executor]")
+{
+    counting_executor counting;
+    si::parallel::set_default_executor(&counting);
+
+    std::vector<int> values(1'000, 1);
+    REQUIRE(si::parallel::reduce(values.begin(), values.end(), 0) == 1'000);
+    si::parallel::parallel_for(0, values.size(), 10,
+                               [&values](size_t i) { values[i] = int(i); });
+    REQUIRE(values[999] == 999);
+    REQUIRE(counting.calls == 2);
+
+    si::parallel::set_default_executor(nullptr);
+    REQUIRE(&si::parallel::default_executor() == &si::parallel::default_pool());
+}
+
+#endif  // ENABLE_SI_PARALLEL
@@ -0,0 +1,137 @@
+#include "catch2/catch_all.hpp"
+
+#include "big_int.hpp"
+#include "si_parallel.hpp"
+#include "strong_decorators.hpp"
+#include "strong_type.hpp"
+
+#ifdef ENABLE_SI_PARALLEL
+
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+using distance_t =
+    strong_type<big_int<16>, struct parallel_distance_tag, addable>;
+
+static std::vector<big_int<16>> random_values(size_t count)
+{
+    std::vector<big_int<16>> values(count);
+    u32 state = 99;
+    for (big_int<16>& value : values)
+    {
+        for (u8& byte : value.raw)
+        {
+            state = state * 1'103'515'245U + 12'345U;
+            byte = u8(state >> 16);
+        }
+    }
+    return values;
+}
+
+TEST_CASE("Parallel reductions match the sequential ones", "[parallel]")
+{
+    si::parallel::thread_pool pool(4);
+    const std::vector<big_int<16>> values = random_values(20'000);
+
+    // the sums wrap, which keeps the addition associative
+    REQUIRE(si::parallel::reduce(pool, values.begin(), values.end(),
+                                 big_int<16>(7), std::plus<>()) ==
+            std::accumulate(values.begin(), values.end(), big_int<16>(7)));
+
+    const auto square = [](const big_int<16>& value) { return value * value; };
+    big_int<16> squares = 0;
+    for (const big_int<16>& value : values)
+    {
+        squares += square(value);
+    }
+    REQUIRE(si::parallel::transform_reduce(pool, values.begin(), values.end(),
+                                           big_int<16>(0), std::plus<>(),
+                                           square) == squares);
+
+    REQUIRE(si::parallel::reduce(values.begin(), values.begin(),
+                                 big_int<16>(3)) == big_int<16>(3));
+
+    std::vector<distance_t> distances;
+    for (int i = 0; i < 5'000; ++i)
+    {
+        distances.emplace_back(big_int<16>(i));
+    }
+    REQUIRE(si::parallel::reduce(pool, distances.begin(), distances.end(),
+                                 distance_t(big_int<16>(0)), std::plus<>())
+                .value == big_int<16>(12'497'500));
+}
+
+TEST_CASE("Parallel scan matches the sequential one", "[parallel]")
+{
+    si::parallel::thread_pool pool(4);
+    std::vector<big_int<16>> values = random_values(10'001);
+
+    std::vector<big_int<16>> expected(values.size());
+    std::partial_sum(values.begin(), values.end(), expected.begin());
+
+    std::vector<big_int<16>> scanned(values.size());
+    REQUIRE(si::parallel::inclusive_scan(pool, values.begin(), values.end(),
+                                         scanned.begin(), std::plus<>()) ==
+            scanned.end());
+    REQUIRE(scanned == expected);
+
+    si::parallel::inclusive_scan(pool, values.begin(), values.end(),
+                                 values.begin(), std::plus<>());
+    REQUIRE(values == expected);
+}
+
+TEST_CASE("Parallel search and sort match the sequential ones", "[parallel]")
+{
+    si::parallel::thread_pool pool(3);
+    std::vector<big_int<16>> values = random_values(30'000);
+    // repeated extremes, the first of them has to be found
+    values[12'345] = values[29'000] = big_int<16>(-1) << 127;
+    values[17] = values[20'000] = ~(big_int<16>(-1) << 127);
+
+    REQUIRE(si::parallel::min_element(pool, values.begin(), values.end(),
+                                      std::less<>()) ==
+            std::min_element(values.begin(), values.end()));
+    REQUIRE(si::parallel::max_element(pool, values.begin(), values.end(),
+                                      std::less<>()) ==
+            std::max_element(values.begin(), values.end()));
+
+    // only the low byte is compared, so the sort has to be stable
+    const auto by_low_byte = [](const big_int<16>& a, const big_int<16>& b)
+    { return a.raw[0] < b.raw[0]; };
+    std::vector<big_int<16>> expected = values;
+    std::stable_sort(expected.begin(), expected.end(), by_low_byte);
+    si::parallel::sort(pool, values.begin(), values.end(), by_low_byte);
+    REQUIRE(values == expected);
+
+    si::parallel::sort(values.begin(), values.end());
+    REQUIRE(std::is_sorted(values.begin(), values.end()));
+}
+
+TEST_CASE("Parallel pool rethrows the exceptions", "[parallel]")
+{
+    si::parallel::thread_pool pool(4);
+    REQUIRE_THROWS_AS(pool.run(100,
+                               [](size_t i)
+                               {
+                                   if (i == 42)
+                                   {
+                                       throw std::runtime_error("failed");
+                                   }
+                               }),
+                      std::runtime_error);
+
+    // the pool stays usable and nested runs do not deadlock
+    std::vector<int> visited(64, 0);
+    pool.run(8,
+             [&](size_t outer)
+             {
+                 pool.run(8,
+                          [&](size_t inner) { ++visited[outer * 8 + inner]; });
+             });
+    REQUIRE(std::all_of(visited.begin(), visited.end(),
+                        [](int count) { return count == 1; }));
+}
+
+#endif  // ENABLE_SI_PARALLEL
@@ -0,0 +1,93 @@
+#include "catch2/catch_all.hpp"
+
+#include "big_int.hpp"
+#include "strong_decorators.hpp"
+#include "strong_dimensions.hpp"
+#include "strong_type.hpp"
+
+#include <functional>
+#include <type_traits>
+
+template <typename dimension_t>
+using quantity_t = strong_type<big_int<32>,
+                               dimension_t,
+                               addable,
+                               comparable,
+                               multipliable,
+                               dividable>;
+
+using meter = quantity_t<dimensions::length>;
+using second = quantity_t<dimensions::time>;
+using kilogram = quantity_t<dimensions::mass>;
+using newton = quantity_t<dimensions::force>;
+using joule = quantity_t<dimensions::energy>;
+
+TEST_CASE("Dimension arithmetic", "[dimensions]")
+{
+    STATIC_REQUIRE(std::is_same<dimensions::energy,
+                                dimension<2, 1, -2, 0, 0, 0, 0>>::value);
+    STATIC_REQUIRE(
+        std::is_same<dimension_quotient_t<dimensions::energy, dimensions::time>,
+                     dimensions::power>::value);
+    STATIC_REQUIRE(
+        std::is_same<dimension_product_t<dimensions::frequency,
+                                         dimensions::time>,
+                     dimensions::dimensionless>::value);
+}
+
+TEST_CASE("Products and quotients get their dimensions", "[dimensions]")
+{
+    const meter distance(big_int<32>(6));
+    const second duration(big_int<32>(2));
+    const kilogram weight(big_int<32>(5));
+
+    const auto speed = distance / duration;
+    STATIC_REQUIRE(std::is_same<decltype(speed),
+                                const quantity_t<dimensions::velocity>>::value);
+    REQUIRE(speed.value == 3);
+
+    const newton force = weight * (speed / duration);
+    const joule work = force * distance;
+    REQUIRE(work.value == 30);
+    REQUIRE((weight * speed * speed).value == 45);
+
+    const joule same_work = distance * force;
+    REQUIRE(same_work == work);
+
+    // a quantity with fewer operations is explicitly made from the same
+    // unit, but never implicitly
+    using plain_area = strong_type<big_int<32>, dimensions::area>;
+    const plain_area area(distance * distance);
+    REQUIRE(area.value == 36);
+    STATIC_REQUIRE(std::is_constructible<plain_area,
+                                         decltype(distance * distance)>::value);
+    STATIC_REQUIRE(!std::is_convertible<decltype(distance * distance),
+                                        plain_area>::value);
+    STATIC_REQUIRE(!std::is_convertible<plain_area,
+                                        decltype(distance * distance)>::value);
+    STATIC_REQUIRE(!std::is_constructible<plain_area, meter>::value);
+
+    STATIC_REQUIRE(!std::is_invocable<std::plus<>, meter, second>::value);
+    STATIC_REQUIRE(!std::is_convertible<meter, second>::value);
+    STATIC_REQUIRE(!std::is_convertible<decltype(distance * distance),
+                                        meter>::value);
+}
+
+TEST_CASE("Long chains of products are resolved at compile time",
+          "[dimensions]")
+{
+    constexpr meter one(big_int<32>(1));
+    constexpr auto chain = one * one * one * one * one * one * one * one *
+                           one * one * one * one * one * one * one * one *
+                           one * one * one * one * one * one * one * one;
+    STATIC_REQUIRE(chain.value == 1);
+    STATIC_REQUIRE(
+        std::is_same<decltype(chain),
+                     const quantity_t<dimension_power_t<dimensions::length,
+                                                        24>>>::value);
+
+    constexpr auto back = chain / one / one / one / one / one / one / one /
+                          one / one / one / one / one / one / one / one /
+                          one / one / one / one / one / one / one / one;
+    STATIC_REQUIRE(std::is_same<decltype(back), const meter>::value);
+}
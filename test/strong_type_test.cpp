@@ -0,0 +1,116 @@
+#include "catch2/catch_all.hpp"
+
+#include "big_int.hpp"
+#include "strong_decorators.hpp"
+#include "strong_type.hpp"
+
+#include <cstring>
+#include <functional>
+#include <type_traits>
+#include <vector>
+
+using length_t = strong_type<big_int<128>, struct strong_length_tag, addable>;
+
+TEST_CASE("Strong types over big_int are trivially copyable", "[strong_type]")
+{
+    STATIC_REQUIRE(std::is_trivially_copyable<length_t>::value);
+    STATIC_REQUIRE(std::is_trivially_copy_constructible<length_t>::value);
+    STATIC_REQUIRE(std::is_trivially_move_constructible<length_t>::value);
+    STATIC_REQUIRE(std::is_trivially_copy_assignable<length_t>::value);
+    STATIC_REQUIRE(std::is_trivially_move_assignable<length_t>::value);
+    STATIC_REQUIRE(std::is_trivially_destructible<length_t>::value);
+    STATIC_REQUIRE(std::is_nothrow_copy_constructible<length_t>::value);
+    STATIC_REQUIRE(std::is_nothrow_move_constructible<length_t>::value);
+    STATIC_REQUIRE(sizeof(length_t) == sizeof(big_int<128>));
+
+    // conversions from the underlying type stay explicit
+    STATIC_REQUIRE(!std::is_convertible<big_int<128>, length_t>::value);
+    STATIC_REQUIRE(!std::is_assignable<length_t&, big_int<128>>::value);
+}
+
+TEST_CASE("Strong types copy bitwise", "[strong_type]")
+{
+    std::vector<length_t> lengths;
+    for (int i = 0; i < 100; ++i)
+    {
+        lengths.emplace_back(big_int<128>(i * 1000));
+    }
+
+    std::vector<length_t> copies(lengths.size());
+    std::memcpy(copies.data(), lengths.data(),
+                lengths.size() * sizeof(length_t));
+    for (size_t i = 0; i < lengths.size(); ++i)
+    {
+        REQUIRE(copies[i].value == lengths[i].value);
+    }
+
+    length_t assigned(big_int<128>(1));
+    assigned = lengths[42];
+    REQUIRE(assigned.value == big_int<128>(42'000));
+    REQUIRE((assigned + lengths[1]).value == big_int<128>(43'000));
+}
+
+using distance_t = strong_type<big_int<16>,
+                               struct strong_distance_tag,
+                               addable,
+                               subtractable,
+                               compound_addable,
+                               comparable,
+                               scalable>;
+
+TEST_CASE("Strong type decorators", "[strong_type]")
+{
+    const distance_t three(big_int<16>(3));
+    const distance_t five(big_int<16>(5));
+
+    REQUIRE((five - three).value == 2);
+    REQUIRE(five.subtract(three).value == 2);
+    REQUIRE((-five).value == -5);
+    REQUIRE((-(five + three)).value == -8);
+    REQUIRE((five + three - three).value == 5);
+    REQUIRE((five - three - three).value == -1);
+
+    distance_t sum(big_int<16>(0));
+    for (int i = 0; i < 10; ++i)
+    {
+        sum += five;
+    }
+    sum -= three;
+    REQUIRE(sum.value == 47);
+
+    REQUIRE(three < five);
+    REQUIRE(three <= five);
+    REQUIRE(five > three);
+    REQUIRE(five >= five);
+    REQUIRE(five == five);
+    REQUIRE(three != five);
+
+    REQUIRE((five * 4).value == 20);
+    REQUIRE((4 * five).value == 20);
+    REQUIRE((five / 2).value == 2);
+    REQUIRE((five * big_int<16>(-3)).value == -15);
+    REQUIRE(((five + three) * 2).value == 16);
+    REQUIRE((five * -7LL).value == -35);
+    REQUIRE((five / short(-2)).value == -2);
+    const u64 wide_factor = u64(1) << 40;
+    REQUIRE((wide_factor * five / 5U).value == big_int<16>(wide_factor));
+
+    distance_t scaled = five;
+    scaled *= 6;
+    scaled /= 4;
+    REQUIRE(scaled.value == 7);
+
+    // only the same strong type or dimensionless factors are accepted
+    STATIC_REQUIRE(
+        !std::is_invocable<std::minus<>, distance_t, length_t>::value);
+    STATIC_REQUIRE(!std::is_invocable<std::less<>, distance_t, int>::value);
+    STATIC_REQUIRE(
+        !std::is_invocable<std::multiplies<>, distance_t, distance_t>::value);
+}
+
+TEST_CASE("Decorators are usable in constant expressions", "[strong_type]")
+{
+    constexpr distance_t two(big_int<16>(2));
+    STATIC_REQUIRE((two * 3 - two).value == 4);
+    STATIC_REQUIRE(two + two > two);
+}
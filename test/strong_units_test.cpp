@@ -0,0 +1,67 @@
+#include "catch2/catch_all.hpp"
+
+#include "big_int.hpp"
+#include "strong_decorators.hpp"
+#include "strong_type.hpp"
+#include "strong_units.hpp"
+
+#include <ratio>
+
+template <typename unit_t>
+using quantity_t = strong_type<big_int<32>, unit_t, addable>;
+
+using meter = quantity_t<dimensions::length>;
+using kilometer = quantity_t<prefixed_t<std::kilo, dimensions::length>>;
+using millimeter = quantity_t<prefixed_t<std::milli, dimensions::length>>;
+using second = quantity_t<dimensions::time>;
+using hour = quantity_t<units::hour>;
+using joule = quantity_t<dimensions::energy>;
+using attojoule = quantity_t<prefixed_t<std::atto, dimensions::energy>>;
+using electronvolt = quantity_t<units::electronvolt>;
+using kiloelectronvolt = quantity_t<prefixed_t<std::kilo, units::electronvolt>>;
+
+TEST_CASE("Conversions between prefixed units", "[units]")
+{
+    STATIC_REQUIRE(quantity_cast<meter>(kilometer(big_int<32>(3))).value ==
+                   3000);
+    STATIC_REQUIRE(quantity_cast<millimeter>(kilometer(big_int<32>(2))).value ==
+                   2'000'000);
+    STATIC_REQUIRE(quantity_cast<kilometer>(meter(big_int<32>(4999))).value ==
+                   4);
+    STATIC_REQUIRE(quantity_cast<meter>(meter(big_int<32>(-7))).value == -7);
+
+    REQUIRE(quantity_cast<second>(hour(big_int<32>(2))).value == 7200);
+    REQUIRE(quantity_cast<hour>(second(big_int<32>(7200))).value == 2);
+}
+
+TEST_CASE("Conversions with small exact factors", "[units]")
+{
+    // 1 eV = 1.602176634e-19 J exactly
+    const electronvolt ten_billion(big_int<32>(10'000'000'000LL));
+    REQUIRE(quantity_cast<attojoule>(ten_billion).value == 1'602'176'634);
+    REQUIRE(quantity_cast<joule>(ten_billion).value == 0);
+
+    const kiloelectronvolt one(big_int<32>(1));
+    REQUIRE(quantity_cast<electronvolt>(one).value == 1000);
+    REQUIRE(quantity_cast<attojoule>(one).value == 160);
+}
+
+TEST_CASE("The conversion factors are folded", "[units]")
+{
+    using factor_t =
+        detail::conversion_factor<big_int<32>,
+                                  units::electronvolt,
+                                  prefixed_t<std::atto, dimensions::energy>>;
+    STATIC_REQUIRE(factor_t::multiplies);
+    STATIC_REQUIRE(factor_t::divides);
+    STATIC_REQUIRE(factor_t::multiplier == 1'602'176'634);
+    STATIC_REQUIRE(factor_t::divisor == 10'000'000'000LL);
+
+    using same_t =
+        detail::conversion_factor<big_int<32>,
+                                  prefixed_t<std::milli, units::hour>,
+                                  prefixed_t<std::ratio<36, 10>,
+                                             dimensions::time>>;
+    STATIC_REQUIRE(!same_t::multiplies);
+    STATIC_REQUIRE(!same_t::divides);
+}
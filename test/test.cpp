@@ -93,4 +93,189 @@ TEST_CASE("Construction from integral", "[ctor]")
                                        std::make_index_sequence<32>>::sequence;
     construction_from_integral_runner<ALL_INTEGRAL>(
         offsetted_index_sequence_test_sizes());
-}
\ No newline at end of file
+}
+
+TEST_CASE("Multiplication matches the built-in integers", "[arithmetic]")
+{
+    for (long long a = -300; a <= 300; a += 7)
+    {
+        for (long long b = -70'000; b <= 70'000; b += 1'337)
+        {
+            REQUIRE(big_int<8>(a) * big_int<8>(b) == big_int<8>(a * b));
+            REQUIRE(big_int<16>(a) * big_int<16>(b) == big_int<16>(a * b));
+        }
+    }
+
+    const big_int<8> max = std::numeric_limits<long long>::max();
+    REQUIRE(max * big_int<8>(2) == big_int<8>(-2));
+}
+
+TEST_CASE("Division truncates towards zero", "[arithmetic]")
+{
+    const long long dividends[] = {0,     1,         -1,      7,
+                                   -7,    255,       256,     -65'537,
+                                   1'000'000'007LL,  -123'456'789'012LL,
+                                   std::numeric_limits<long long>::max(),
+                                   std::numeric_limits<long long>::min()};
+    const long long divisors[] = {1,    -1,         2,      -3,     7,
+                                  255,  256,        -257,   65'536, 99'991,
+                                  -1'000'000'007LL, 4'294'967'311LL,
+                                  std::numeric_limits<long long>::max()};
+
+    for (const long long a : dividends)
+    {
+        for (const long long b : divisors)
+        {
+            if (a == std::numeric_limits<long long>::min() && b == -1)
+            {
+                continue;
+            }
+            REQUIRE(big_int<8>(a) / big_int<8>(b) == big_int<8>(a / b));
+            REQUIRE(big_int<8>(a) % big_int<8>(b) == big_int<8>(a % b));
+            REQUIRE(big_int<13>(a) / big_int<13>(b) == big_int<13>(a / b));
+            REQUIRE(big_int<13>(a) % big_int<13>(b) == big_int<13>(a % b));
+        }
+    }
+
+    REQUIRE_THROWS_AS(big_int<8>(1) / big_int<8>(0), std::domain_error);
+}
+
+TEST_CASE("Division inverts multiplication", "[arithmetic]")
+{
+    big_int<64> a = 1;
+    big_int<64> b = 3;
+    // stays below 2^511, so the values do not wrap
+    for (int i = 0; i < 24; ++i)
+    {
+        a = a * big_int<64>(1'000'003) + big_int<64>(i);
+        b = b * big_int<64>(97) + big_int<64>(1);
+
+        const big_int<64> quotient = a / b;
+        const big_int<64> remainder = a % b;
+        REQUIRE(quotient * b + remainder == a);
+        REQUIRE(!remainder.is_negative());
+        REQUIRE(remainder < b);
+    }
+}
+
+// The expected values are computed exactly in a wider big_int and then
+// truncated, so the native operands may be wider than the big_int
+template <size_t size, typename T>
+static void check_native_operands(const big_int<size>& number, T native)
+{
+    using wide_t = big_int<size + sizeof(u64)>;
+    const wide_t wide_number(number);
+    const wide_t wide_native = native;
+
+    REQUIRE(number * native == big_int<size>(wide_number * wide_native));
+    REQUIRE(native * number == big_int<size>(wide_number * wide_native));
+    if (native != 0)
+    {
+        REQUIRE(number / native == big_int<size>(wide_number / wide_native));
+    }
+}
+
+TEST_CASE("Native integer operands match the converted ones", "[arithmetic]")
+{
+    const long long values[] = {0,
+                                1,
+                                -1,
+                                255,
+                                -256,
+                                65'537,
+                                -1'000'000'007LL,
+                                4'294'967'311LL,
+                                -123'456'789'012'345LL,
+                                std::numeric_limits<long long>::max(),
+                                std::numeric_limits<long long>::min()};
+
+    big_int<64> wide = 1;
+    for (int i = 0; i < 60; ++i)
+    {
+        wide = wide * big_int<64>(1'000'003) + big_int<64>(i);
+    }
+
+    for (const long long a : values)
+    {
+        for (const long long b : values)
+        {
+            check_native_operands(big_int<8>(a), b);
+            check_native_operands(big_int<13>(a), b);
+            check_native_operands(big_int<13>(a), u64(b));
+            check_native_operands(big_int<4>(big_int<8>(a)), b);
+            check_native_operands(big_int<4>(big_int<8>(a)), u64(b));
+            check_native_operands(big_int<13>(a), int(b));
+            check_native_operands(big_int<13>(a), u8(b));
+            check_native_operands(big_int<13>(a), short(b));
+        }
+        check_native_operands(wide, a);
+        check_native_operands(-wide, a);
+        check_native_operands(wide, u64(a));
+        check_native_operands(-wide, u32(a));
+    }
+
+    big_int<8> compound = 1'000;
+    compound *= -3;
+    compound /= 7U;
+    REQUIRE(compound == big_int<8>(-428));
+    REQUIRE_THROWS_AS(big_int<8>(1) / 0, std::domain_error);
+    STATIC_REQUIRE(big_int<16>(-21) * 2 / 3 == big_int<16>(-14));
+}
+
+TEST_CASE("Conversion between sizes", "[ctor]")
+{
+    REQUIRE(big_int<16>(big_int<8>(-5)) == big_int<16>(-5));
+    REQUIRE(big_int<16>(big_int<8>(5)) == big_int<16>(5));
+    REQUIRE(big_int<4>(big_int<16>(-70'000)) == big_int<4>(-70'000));
+}
+
+template <size_t size>
+big_int<size> ripple_sum(const big_int<size>& a, const big_int<size>& b)
+{
+    big_int<size> res;
+    u32 carry = 0;
+    for (size_t i = 0; i < size; ++i)
+    {
+        const u32 sum = a.raw[i] + u32(b.raw[i]) + carry;
+        res.raw[i] = u8(sum);
+        carry = sum >> 8;
+    }
+    return res;
+}
+
+TEMPLATE_TEST_CASE_SIG("Carry-lookahead addition matches the ripple carry",
+                       "[arithmetic]",
+                       ((size_t size), size),
+                       32,
+                       75,
+                       4104)
+{
+    // all ones plus one carries through every word and every block
+    REQUIRE(big_int<size>(-1) + big_int<size>(1) == big_int<size>(0));
+    REQUIRE(big_int<size>(-1) + big_int<size>(-1) == big_int<size>(-2));
+    STATIC_REQUIRE(big_int<64>(-1) + big_int<64>(1) == big_int<64>(0));
+
+    u32 state = 12'345;
+    const auto next_byte = [&state]()
+    {
+        state = state * 1'103'515'245U + 12'345U;
+        return u8(state >> 16);
+    };
+
+    for (int iteration = 0; iteration < 50; ++iteration)
+    {
+        big_int<size> a;
+        big_int<size> b;
+        for (size_t i = 0; i < size; ++i)
+        {
+            a.raw[i] = next_byte();
+            // long runs of words that only propagate a carry
+            b.raw[i] = (i / 8) % 3 == 0 ? next_byte() : u8(~a.raw[i]);
+        }
+        REQUIRE(a + b == ripple_sum(a, b));
+
+        big_int<size> aliased = a;
+        aliased += aliased;
+        REQUIRE(aliased == ripple_sum(a, a));
+    }
+}